@@ -23,6 +23,7 @@
 #include <KDecoration2/DecoratedClient>
 #include <KColorUtils>
 
+#include <QCache>
 #include <QPainter>
 
 namespace Breeze
@@ -32,6 +33,50 @@ namespace Breeze
     using KDecoration2::ColorGroup;
     using KDecoration2::DecorationButtonType;
 
+    namespace
+    {
+
+        //* rendered button icons are fully determined by these
+        struct IconCacheKey
+        {
+            int type;
+            bool checked;
+            QSize size;
+            qreal devicePixelRatio;
+            QRgb foreground;
+            QRgb background;
+            QRgb titleBar;
+
+            bool operator == ( const IconCacheKey& other ) const
+            {
+                return
+                    type == other.type &&
+                    checked == other.checked &&
+                    size == other.size &&
+                    devicePixelRatio == other.devicePixelRatio &&
+                    foreground == other.foreground &&
+                    background == other.background &&
+                    titleBar == other.titleBar;
+            }
+
+        };
+
+        inline uint qHash( const IconCacheKey& key, uint seed = 0 )
+        {
+            return ::qHash( key.foreground, seed ) ^ ::qHash( key.background, seed << 1 ) ^ ::qHash( key.titleBar, seed << 2 ) ^
+                ::qHash( (key.type << 1) | int(key.checked) ) ^ ::qHash( (key.size.width() << 16) | key.size.height() ) ^
+                ::qHash( key.devicePixelRatio );
+        }
+
+        //* invalid colors are stored as zero, they are never painted
+        inline QRgb cacheColor( const QColor& color )
+        { return color.isValid() ? color.rgba():0; }
+
+        //* icons shared between all buttons of all decorations
+        QCache<IconCacheKey, QImage> s_iconCache( 256 );
+
+    }
+
 
     //__________________________________________________________________
     Button::Button(DecorationButtonType type, Decoration* decoration, QObject* parent)
@@ -141,7 +186,15 @@ namespace Breeze
 
         } else {
 
-            drawIcon( painter );
+            painter->translate( geometry().topLeft() );
+
+            /*
+            use cached images unless colors are transient,
+            in which case caching them would just thrash the cache
+            */
+            auto d = qobject_cast<Decoration*>( decoration() );
+            if( d && !isPressed() && !d->isAnimated() ) drawCachedIcon( painter, d );
+            else drawIcon( painter, foregroundColor(), backgroundColor() );
 
         }
 
@@ -150,7 +203,55 @@ namespace Breeze
     }
 
     //__________________________________________________________________
-    void Button::drawIcon( QPainter *painter ) const
+    void Button::drawCachedIcon( QPainter *painter, Decoration* d ) const
+    {
+
+        const qreal devicePixelRatio( painter->device() ? painter->device()->devicePixelRatioF():1.0 );
+
+        // hover animation is a crossfade between idle and hovered images
+        if( m_animation->state() == QPropertyAnimation::Running )
+        {
+
+            painter->drawImage( QPointF( 0, 0 ), cachedIcon( d, false, devicePixelRatio ) );
+            painter->setOpacity( painter->opacity()*m_opacity );
+            painter->drawImage( QPointF( 0, 0 ), cachedIcon( d, true, devicePixelRatio ) );
+
+        } else painter->drawImage( QPointF( 0, 0 ), cachedIcon( d, isHovered(), devicePixelRatio ) );
+
+    }
+
+    //__________________________________________________________________
+    QImage Button::cachedIcon( Decoration* d, bool hovered, qreal devicePixelRatio ) const
+    {
+
+        const QColor foregroundColor( this->foregroundColor( d, hovered ) );
+        const QColor backgroundColor( this->backgroundColor( d, hovered ) );
+
+        const IconCacheKey key = {
+            int( type() ), isChecked(), m_iconSize, devicePixelRatio,
+            cacheColor( foregroundColor ),
+            cacheColor( backgroundColor ),
+            cacheColor( d->titleBarColor() ) };
+
+        if( QImage* image = s_iconCache.object( key ) ) return *image;
+
+        // render
+        QImage* image = new QImage( m_iconSize*devicePixelRatio, QImage::Format_ARGB32_Premultiplied );
+        image->setDevicePixelRatio( devicePixelRatio );
+        image->fill( Qt::transparent );
+
+        QPainter painter( image );
+        drawIcon( &painter, foregroundColor, backgroundColor );
+        painter.end();
+
+        const QImage out( *image );
+        s_iconCache.insert( key, image );
+        return out;
+
+    }
+
+    //__________________________________________________________________
+    void Button::drawIcon( QPainter *painter, const QColor& foregroundColor, const QColor& backgroundColor ) const
     {
 
         painter->setRenderHints( QPainter::Antialiasing );
@@ -160,14 +261,11 @@ namespace Breeze
         this makes all further rendering and scaling simpler
         all further rendering is preformed inside QRect( 0, 0, 18, 18 )
         */
-        painter->translate( geometry().topLeft() );
-
         const qreal width( m_iconSize.width() );
         painter->scale( width/20, width/20 );
         painter->translate( 1, 1 );
 
         // render background
-        const QColor backgroundColor( this->backgroundColor() );
         if( backgroundColor.isValid() )
         {
             painter->setPen( Qt::NoPen );
@@ -176,7 +274,6 @@ namespace Breeze
         }
 
         // render mark
-        const QColor foregroundColor( this->foregroundColor() );
         if( foregroundColor.isValid() )
         {
 
@@ -242,13 +339,13 @@ namespace Breeze
                         painter->drawEllipse( QRectF( 3, 3, 12, 12 ) );
 
                         // center dot
-                        QColor backgroundColor( this->backgroundColor() );
+                        QColor dotColor( backgroundColor );
                         auto d = qobject_cast<Decoration*>( decoration() );
-                        if( !backgroundColor.isValid() && d ) backgroundColor = d->titleBarColor();
+                        if( !dotColor.isValid() && d ) dotColor = d->titleBarColor();
 
-                        if( backgroundColor.isValid() )
+                        if( dotColor.isValid() )
                         {
-                            painter->setBrush( backgroundColor );
+                            painter->setBrush( dotColor );
                             painter->drawEllipse( QRectF( 8, 8, 2, 2 ) );
                         }
 
@@ -360,29 +457,21 @@ namespace Breeze
 
             return QColor();
 
-        } else if( isPressed() ) {
+        } else if( isPressed() || m_animation->state() != QPropertyAnimation::Running ) {
 
-            return d->titleBarColor();
+            return foregroundColor( d, isHovered() );
 
         } else if( type() == DecorationButtonType::Close && d->internalSettings()->outlineCloseButton() ) {
 
-            return d->titleBarColor();
+            return foregroundColor( d, isHovered() );
 
         } else if( ( type() == DecorationButtonType::KeepBelow || type() == DecorationButtonType::KeepAbove ) && isChecked() ) {
 
-            return d->titleBarColor();
-
-        } else if( m_animation->state() == QPropertyAnimation::Running ) {
-
-            return KColorUtils::mix( d->fontColor(), d->titleBarColor(), m_opacity );
-
-        } else if( isHovered() ) {
-
-            return d->titleBarColor();
+            return foregroundColor( d, isHovered() );
 
         } else {
 
-            return d->fontColor();
+            return KColorUtils::mix( foregroundColor( d, false ), foregroundColor( d, true ), m_opacity );
 
         }
 
@@ -396,44 +485,71 @@ namespace Breeze
 
             return QColor();
 
+        } else if( isPressed() || m_animation->state() != QPropertyAnimation::Running ) {
+
+            return backgroundColor( d, isHovered() );
+
+        } else if( ( type() == DecorationButtonType::KeepBelow || type() == DecorationButtonType::KeepAbove ) && isChecked() ) {
+
+            return backgroundColor( d, isHovered() );
+
         }
 
-        auto c = d->client().data();
+        // animate between idle and hovered colors
+        const QColor hovered( backgroundColor( d, true ) );
+        const QColor idle( backgroundColor( d, false ) );
+        if( idle.isValid() ) return KColorUtils::mix( idle, hovered, m_opacity );
+        else {
+
+            QColor color( hovered );
+            color.setAlpha( color.alpha()*m_opacity );
+            return color;
+
+        }
+
+    }
+
+    //__________________________________________________________________
+    QColor Button::foregroundColor( Decoration* d, bool hovered ) const
+    {
         if( isPressed() ) {
 
-            if( type() == DecorationButtonType::Close ) return c->color( ColorGroup::Warning, ColorRole::Foreground );
-            else return KColorUtils::mix( d->titleBarColor(), d->fontColor(), 0.3 );
+            return d->titleBarColor();
+
+        } else if( type() == DecorationButtonType::Close && d->internalSettings()->outlineCloseButton() ) {
+
+            return d->titleBarColor();
 
         } else if( ( type() == DecorationButtonType::KeepBelow || type() == DecorationButtonType::KeepAbove ) && isChecked() ) {
 
-            return d->fontColor();
+            return d->titleBarColor();
 
-        } else if( m_animation->state() == QPropertyAnimation::Running ) {
+        } else if( hovered ) {
 
-            if( type() == DecorationButtonType::Close )
-            {
-                if( d->internalSettings()->outlineCloseButton() )
-                {
+            return d->titleBarColor();
 
-                    return KColorUtils::mix( d->fontColor(), c->color( ColorGroup::Warning, ColorRole::Foreground ).lighter(), m_opacity );
+        } else {
 
-                } else {
+            return d->fontColor();
 
-                    QColor color( c->color( ColorGroup::Warning, ColorRole::Foreground ).lighter() );
-                    color.setAlpha( color.alpha()*m_opacity );
-                    return color;
+        }
 
-                }
+    }
 
-            } else {
+    //__________________________________________________________________
+    QColor Button::backgroundColor( Decoration* d, bool hovered ) const
+    {
+        auto c = d->client().data();
+        if( isPressed() ) {
+
+            if( type() == DecorationButtonType::Close ) return c->color( ColorGroup::Warning, ColorRole::Foreground );
+            else return KColorUtils::mix( d->titleBarColor(), d->fontColor(), 0.3 );
 
-                QColor color( d->fontColor() );
-                color.setAlpha( color.alpha()*m_opacity );
-                return color;
+        } else if( ( type() == DecorationButtonType::KeepBelow || type() == DecorationButtonType::KeepAbove ) && isChecked() ) {
 
-            }
+            return d->fontColor();
 
-        } else if( isHovered() ) {
+        } else if( hovered ) {
 
             if( type() == DecorationButtonType::Close ) return c->color( ColorGroup::Warning, ColorRole::Foreground ).lighter();
             else return d->fontColor();
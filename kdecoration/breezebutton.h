@@ -111,13 +111,23 @@ namespace Breeze
         //* private constructor
         explicit Button(KDecoration2::DecorationButtonType type, Decoration *decoration, QObject *parent = nullptr);
 
-        //* draw button icon
-        void drawIcon( QPainter *) const;
+        //* draw button icon, from its own top left corner
+        void drawIcon( QPainter*, const QColor& foregroundColor, const QColor& backgroundColor ) const;
+
+        //* draw button icon from cached idle and hovered images
+        void drawCachedIcon( QPainter*, Decoration* ) const;
+
+        //* cached icon for given hover state and device pixel ratio
+        QImage cachedIcon( Decoration*, bool hovered, qreal devicePixelRatio ) const;
 
         //*@name colors
         //@{
         QColor foregroundColor() const;
         QColor backgroundColor() const;
+
+        //* colors at the end points of the hover animation
+        QColor foregroundColor( Decoration*, bool hovered ) const;
+        QColor backgroundColor( Decoration*, bool hovered ) const;
         //@}
 
         Flag m_flag = FlagNone;
@@ -27,6 +27,7 @@
 #include "config/breezeconfigwidget.h"
 
 #include "breezebutton.h"
+#include "breezeprofiler.h"
 #include "breezesizegrip.h"
 
 #include "breezeboxshadowhelper.h"
@@ -161,6 +162,7 @@ namespace Breeze
         , m_animation( new QPropertyAnimation( this ) )
     {
         g_sDecoCount++;
+        if( Profiler::isEnabled() ) m_creationTimer.start();
     }
 
     //________________________________________________________________
@@ -170,10 +172,16 @@ namespace Breeze
         if (g_sDecoCount == 0) {
             // last deco destroyed, clean up shadow
             g_sShadow.clear();
+
+            // report timings
+            Profiler::dump();
         }
 
         deleteSizeGrip();
 
+        // last deco destroyed, clean up pooled size grips
+        if( g_sDecoCount == 0 ) SizeGrip::clearPool();
+
     }
 
     //________________________________________________________________
@@ -235,6 +243,7 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::init()
     {
+        Profiler::ScopedTimer timer( Profiler::Init );
         auto c = client().data();
 
         // active state change animation
@@ -285,6 +294,11 @@ namespace Breeze
         connect(c, &KDecoration2::DecoratedClient::adjacentScreenEdgesChanged, this, &Decoration::updateButtonsGeometry);
         connect(c, &KDecoration2::DecoratedClient::shadedChanged, this, &Decoration::updateButtonsGeometry);
 
+        // size grip is only created when actually visible
+        connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateSizeGripVisibility);
+        connect(c, &KDecoration2::DecoratedClient::shadedChanged, this, &Decoration::updateSizeGripVisibility);
+        connect(c, &KDecoration2::DecoratedClient::resizeableChanged, this, &Decoration::updateSizeGripVisibility);
+
         createButtons();
         createShadow();
     }
@@ -323,8 +337,13 @@ namespace Breeze
     void Decoration::updateSizeGripVisibility()
     {
         auto c = client().data();
-        if( m_sizeGrip )
-        { m_sizeGrip->setVisible( c->isResizeable() && !isMaximized() && !c->isShaded() ); }
+        const bool visible(
+            hasNoBorders() && m_internalSettings->drawSizeGrip() &&
+            c->isResizeable() && !isMaximized() && !c->isShaded() );
+
+        // size grips are returned to the pool when hidden, rather than kept unmapped
+        if( visible ) createSizeGrip();
+        else deleteSizeGrip();
     }
 
     //________________________________________________________________
@@ -369,6 +388,7 @@ namespace Breeze
     void Decoration::reconfigure()
     {
 
+        Profiler::ScopedTimer timer( Profiler::Reconfigure );
         m_internalSettings = SettingsProvider::self()->internalSettings( this );
 
         // animation
@@ -381,8 +401,7 @@ namespace Breeze
         createShadow();
 
         // size grip
-        if( hasNoBorders() && m_internalSettings->drawSizeGrip() ) createSizeGrip();
-        else deleteSizeGrip();
+        updateSizeGripVisibility();
 
     }
 
@@ -437,6 +456,7 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::createButtons()
     {
+        Profiler::ScopedTimer timer( Profiler::CreateButtons );
         m_leftButtons = new KDecoration2::DecorationButtonGroup(KDecoration2::DecorationButtonGroup::Position::Left, this, &Button::create);
         m_rightButtons = new KDecoration2::DecorationButtonGroup(KDecoration2::DecorationButtonGroup::Position::Right, this, &Button::create);
         updateButtonsGeometry();
@@ -553,6 +573,13 @@ namespace Breeze
             painter->restore();
         }
 
+        // creation to first paint latency
+        if( m_creationTimer.isValid() )
+        {
+            Profiler::record( Profiler::FirstPaint, m_creationTimer.nsecsElapsed() );
+            m_creationTimer.invalidate();
+        }
+
     }
 
     //________________________________________________________________
@@ -707,6 +734,7 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::createShadow()
     {
+        Profiler::ScopedTimer timer( Profiler::CreateShadow );
         if (!g_sShadow
                 ||g_shadowSizeEnum != m_internalSettings->shadowSize()
                 || g_shadowStrength != m_internalSettings->shadowStrength()
@@ -809,13 +837,7 @@ namespace Breeze
         auto c = client().data();
         if( !c ) return;
 
-        if( c->windowId() != 0 )
-        {
-            m_sizeGrip = new SizeGrip( this );
-            connect( c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateSizeGripVisibility );
-            connect( c, &KDecoration2::DecoratedClient::shadedChanged, this, &Decoration::updateSizeGripVisibility );
-            connect( c, &KDecoration2::DecoratedClient::resizeableChanged, this, &Decoration::updateSizeGripVisibility );
-        }
+        if( c->windowId() != 0 ) m_sizeGrip = SizeGrip::acquire( this );
         #endif
 
     }
@@ -825,7 +847,7 @@ namespace Breeze
     {
         if( m_sizeGrip )
         {
-            m_sizeGrip->deleteLater();
+            SizeGrip::release( m_sizeGrip );
             m_sizeGrip = nullptr;
         }
     }
@@ -29,6 +29,7 @@
 #include <KDecoration2/DecoratedClient>
 #include <KDecoration2/DecorationSettings>
 
+#include <QElapsedTimer>
 #include <QPalette>
 #include <QPropertyAnimation>
 #include <QVariant>
@@ -77,6 +78,10 @@ namespace Breeze
         qreal opacity() const
         { return m_opacity; }
 
+        //* true if active state change animation is running
+        bool isAnimated() const
+        { return m_animation->state() == QPropertyAnimation::Running; }
+
         //@}
 
         //*@name colors
@@ -150,6 +155,9 @@ namespace Breeze
         //* active state change opacity
         qreal m_opacity = 0;
 
+        //* time since creation, only valid until first paint when profiling
+        QElapsedTimer m_creationTimer;
+
     };
 
     bool Decoration::hasBorders() const
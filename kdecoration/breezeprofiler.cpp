@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezeprofiler.h"
+
+#include <QString>
+#include <QtGlobal>
+
+Q_LOGGING_CATEGORY(BREEZE_DECORATION_PROFILE, "breeze.decoration.profile", QtInfoMsg)
+
+namespace Breeze
+{
+
+    //________________________________________________________________
+    Profiler::Histogram Profiler::s_histograms[Profiler::PhaseCount];
+
+    //________________________________________________________________
+    bool Profiler::isEnabled()
+    {
+        static const bool enabled( qEnvironmentVariableIsSet( "BREEZE_DECORATION_PROFILE" ) );
+        return enabled;
+    }
+
+    //________________________________________________________________
+    void Profiler::record( Phase phase, qint64 value )
+    {
+
+        if( !isEnabled() ) return;
+
+        // bucket index is log2 of duration in microseconds
+        const qint64 microseconds( value/1000 );
+        int bucket = 0;
+        while( bucket < BucketCount - 1 && (qint64(1) << bucket) <= microseconds ) ++bucket;
+
+        Histogram& histogram( s_histograms[phase] );
+        ++histogram.buckets[bucket];
+        ++histogram.count;
+        histogram.total += value;
+        histogram.maximum = qMax( histogram.maximum, value );
+
+        // periodic dump, based on the number of fully painted decorations
+        if( phase == FirstPaint && histogram.count%DumpInterval == 0 ) dump();
+
+    }
+
+    //________________________________________________________________
+    void Profiler::dump()
+    {
+
+        if( !isEnabled() ) return;
+
+        static const char* const names[PhaseCount] =
+        {
+            "init",
+            "reconfigure",
+            "exceptionMatching",
+            "createButtons",
+            "createShadow",
+            "firstPaint"
+        };
+
+        for( int phase = 0; phase < PhaseCount; ++phase )
+        {
+
+            const Histogram& histogram( s_histograms[phase] );
+            if( !histogram.count ) continue;
+
+            QString buckets;
+            for( int bucket = 0; bucket < BucketCount; ++bucket )
+            {
+                if( !histogram.buckets[bucket] ) continue;
+                if( bucket == BucketCount - 1 ) buckets += QStringLiteral( " >=%1us:%2" ).arg( qint64(1) << (bucket-1) ).arg( histogram.buckets[bucket] );
+                else buckets += QStringLiteral( " <%1us:%2" ).arg( qint64(1) << bucket ).arg( histogram.buckets[bucket] );
+            }
+
+            qCInfo( BREEZE_DECORATION_PROFILE, "%s: count=%u mean=%lldus max=%lldus |%s",
+                names[phase],
+                histogram.count,
+                histogram.total/histogram.count/1000,
+                histogram.maximum/1000,
+                qPrintable( buckets ) );
+
+        }
+
+    }
+
+}
@@ -0,0 +1,116 @@
+#ifndef BREEZE_PROFILER_H
+#define BREEZE_PROFILER_H
+
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+
+Q_DECLARE_LOGGING_CATEGORY(BREEZE_DECORATION_PROFILE)
+
+namespace Breeze
+{
+
+    //* records decoration creation timings, when BREEZE_DECORATION_PROFILE is set in the environment
+    /**
+    timings are accumulated in per-phase histograms of power-of-two microsecond buckets,
+    and written to the breeze.decoration.profile logging category
+    every DumpInterval decorations, as well as when the last decoration is destroyed
+    */
+    class Profiler
+    {
+
+        public:
+
+        //* instrumented phases. Phases may nest, in which case timings are inclusive
+        enum Phase
+        {
+            Init,
+            Reconfigure,
+            ExceptionMatching,
+            CreateButtons,
+            CreateShadow,
+            FirstPaint,
+            PhaseCount
+        };
+
+        //* true if profiling is enabled
+        static bool isEnabled();
+
+        //* record duration (nanoseconds) for given phase
+        static void record( Phase, qint64 );
+
+        //* write histograms to logging category
+        static void dump();
+
+        //* times the enclosing scope and records it on destruction
+        class ScopedTimer
+        {
+
+            public:
+
+            //* constructor
+            explicit ScopedTimer( Phase phase ):
+                m_phase( phase )
+            { if( isEnabled() ) m_timer.start(); }
+
+            //* destructor
+            ~ScopedTimer()
+            { if( m_timer.isValid() ) record( m_phase, m_timer.nsecsElapsed() ); }
+
+            private:
+
+            //* phase
+            Phase m_phase;
+
+            //* timer
+            QElapsedTimer m_timer;
+
+            Q_DISABLE_COPY( ScopedTimer )
+
+        };
+
+        private:
+
+        //* number of histogram buckets. Last bucket collects everything above
+        enum
+        {
+            BucketCount = 16,
+            DumpInterval = 100
+        };
+
+        //* per phase statistics
+        struct Histogram
+        {
+            quint32 buckets[BucketCount] = {};
+            quint32 count = 0;
+            qint64 total = 0;
+            qint64 maximum = 0;
+        };
+
+        //* histograms
+        static Histogram s_histograms[PhaseCount];
+
+    };
+
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include "breezesettingsprovider.h"
 
 #include "breezeexceptionlist.h"
+#include "breezeprofiler.h"
 
 #include <KWindowInfo>
 
@@ -71,6 +72,8 @@ namespace Breeze
     InternalSettingsPtr SettingsProvider::internalSettings( Decoration *decoration ) const
     {
 
+        Profiler::ScopedTimer timer( Profiler::ExceptionMatching );
+
         QString windowTitle;
         QString className;
 
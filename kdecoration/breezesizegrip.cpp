@@ -22,6 +22,7 @@
 
 #include <KDecoration2/DecoratedClient>
 
+#include <QList>
 #include <QPainter>
 #include <QPolygon>
 #include <QTimer>
@@ -36,9 +37,11 @@ namespace Breeze
     //* scoped pointer convenience typedef
     template <typename T> using ScopedPointer = QScopedPointer<T, QScopedPointerPodDeleter>;
 
+    //* pool of detached size grips, ready for reuse
+    static QList<QPointer<SizeGrip>> g_sizeGripPool;
+
     //_____________________________________________
-    SizeGrip::SizeGrip( Decoration* decoration ):QWidget(nullptr)
-        ,m_decoration( decoration )
+    SizeGrip::SizeGrip():QWidget(nullptr)
     {
 
         setAttribute(Qt::WA_NoSystemBackground );
@@ -58,6 +61,56 @@ namespace Breeze
             << QPoint( 0, GripSize );
 
         setMask( QRegion( p ) );
+        setWindowTitle( "Breeze::SizeGrip" );
+
+    }
+
+    //_____________________________________________
+    SizeGrip::~SizeGrip()
+    {}
+
+    //_____________________________________________
+    SizeGrip* SizeGrip::acquire( Decoration* decoration )
+    {
+
+        // try recycle a pooled size grip
+        SizeGrip* sizeGrip( nullptr );
+        while( !sizeGrip && !g_sizeGripPool.isEmpty() )
+        { sizeGrip = g_sizeGripPool.takeLast().data(); }
+
+        if( !sizeGrip ) sizeGrip = new SizeGrip();
+        sizeGrip->setDecoration( decoration );
+        return sizeGrip;
+
+    }
+
+    //_____________________________________________
+    void SizeGrip::release( SizeGrip* sizeGrip )
+    {
+
+        if( !sizeGrip ) return;
+        sizeGrip->detach();
+
+        if( g_sizeGripPool.size() < MaxPoolSize ) g_sizeGripPool.append( sizeGrip );
+        else sizeGrip->deleteLater();
+
+    }
+
+    //_____________________________________________
+    void SizeGrip::clearPool()
+    {
+        foreach( const QPointer<SizeGrip>& sizeGrip, g_sizeGripPool )
+        { if( sizeGrip ) sizeGrip.data()->deleteLater(); }
+
+        g_sizeGripPool.clear();
+    }
+
+    //_____________________________________________
+    void SizeGrip::setDecoration( Decoration* decoration )
+    {
+
+        m_decoration = decoration;
+        m_stackingDirty = true;
 
         // embed
         embed();
@@ -75,18 +128,48 @@ namespace Breeze
     }
 
     //_____________________________________________
-    SizeGrip::~SizeGrip()
-    {}
+    void SizeGrip::detach()
+    {
+
+        hide();
+
+        if( m_decoration )
+        {
+            auto c = m_decoration.data()->client().data();
+            if( c ) disconnect( c, nullptr, this, nullptr );
+        }
+
+        m_decoration.clear();
+
+        #if BREEZE_HAVE_X11
+        /*
+        move the native window back to the root window,
+        so that it survives the destruction of the client's frame
+        */
+        if( QX11Info::isPlatformX11() )
+        {
+            auto connection = QX11Info::connection();
+            xcb_reparent_window( connection, winId(), QX11Info::appRootWindow(), 0, 0 );
+            xcb_flush( connection );
+        }
+        #endif
+
+    }
 
     //_____________________________________________
     void SizeGrip::updateActiveState()
     {
         #if BREEZE_HAVE_X11
-        if( QX11Info::isPlatformX11() )
+        /*
+        stacking only needs to be enforced once after being embedded,
+        activation changes alone do not alter the order of the frame's children
+        */
+        if( m_stackingDirty && QX11Info::isPlatformX11() )
         {
             const quint32 value = XCB_STACK_MODE_ABOVE;
             xcb_configure_window( QX11Info::connection(), winId(), XCB_CONFIG_WINDOW_STACK_MODE, &value );
             xcb_map_window( QX11Info::connection(), winId() );
+            m_stackingDirty = false;
         }
         #endif
 
@@ -119,7 +202,6 @@ namespace Breeze
 
             // reparent
             xcb_reparent_window( connection, winId(), current, 0, 0 );
-            setWindowTitle( "Breeze::SizeGrip" );
 
         } else {
 
@@ -166,7 +248,7 @@ namespace Breeze
             case Qt::RightButton:
             {
                 hide();
-                QTimer::singleShot(5000, this, SLOT(show()));
+                QTimer::singleShot(5000, this, [this]() { if( m_decoration ) show(); } );
                 break;
             }
 
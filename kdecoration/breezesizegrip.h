@@ -36,6 +36,11 @@ namespace Breeze
 {
 
     //* implements size grip for all widgets
+    /**
+    native size grip windows are expensive to create and embed.
+    They are handed out through acquire() and returned through release(),
+    which keeps a small pool of unmapped windows ready for reuse
+    */
     class SizeGrip: public QWidget
     {
 
@@ -43,12 +48,18 @@ namespace Breeze
 
         public:
 
-        //* constructor
-        explicit SizeGrip( Decoration* );
-
-        //* constructor
+        //* destructor
         virtual ~SizeGrip();
 
+        //* get a size grip for given decoration, possibly recycled from the pool
+        static SizeGrip* acquire( Decoration* );
+
+        //* detach size grip from its decoration and return it to the pool
+        static void release( SizeGrip* );
+
+        //* delete all pooled size grips
+        static void clearPool();
+
         protected Q_SLOTS:
 
         //* update background color
@@ -75,18 +86,31 @@ namespace Breeze
 
         private:
 
+        //* constructor
+        explicit SizeGrip();
+
+        //* assign decoration, and connect to its client
+        void setDecoration( Decoration* );
+
+        //* disconnect from decoration and reparent to root window
+        void detach();
+
         //* send resize event
         void sendMoveResizeEvent( QPoint );
 
         //* grip size
         enum {
             Offset = 0,
-            GripSize = 14
+            GripSize = 14,
+            MaxPoolSize = 8
         };
 
         //* decoration
         QPointer<Decoration> m_decoration;
 
+        //* true when window must be restacked above its siblings on next activation change
+        bool m_stackingDirty = true;
+
         //* move/resize atom
         #if BREEZE_HAVE_X11
         xcb_atom_t m_moveResizeAtom = 0;
@@ -94,7 +118,6 @@ namespace Breeze
 
     };
 
-
 }
 
 #endif
@@ -57,6 +57,10 @@ namespace Breeze
         static void setSteps( int value )
         { _steps = value; }
 
+        //* steps
+        static int steps()
+        { return _steps; }
+
         //* enability
         virtual bool enabled() const
         { return _enabled; }
@@ -20,6 +20,7 @@
 #include "breezeanimations.h"
 #include "breezepropertynames.h"
 #include "breezestyleconfigdata.h"
+#include "breezewidgetroles.h"
 
 #include <QAbstractItemView>
 #include <QComboBox>
@@ -39,6 +40,9 @@
 namespace Breeze
 {
 
+    //* maximum number of idle animations kept in the pool
+    static const int s_animationPoolSize = 32;
+
     //____________________________________________________________
     Animations::Animations( QObject* parent ):
         QObject( parent )
@@ -60,6 +64,15 @@ namespace Breeze
 
     }
 
+    //____________________________________________________________
+    Animations::~Animations()
+    {
+        foreach( const Animation::Pointer& animation, _animationPool )
+        { if( animation ) delete animation.data(); }
+
+        _animationPool.clear();
+    }
+
     //____________________________________________________________
     void Animations::setupEngines()
     {
@@ -112,24 +125,27 @@ namespace Breeze
         // all widgets are registered to the enability engine.
         _widgetEnabilityEngine->registerWidget( widget, AnimationEnable );
 
+        // widget roles
+        const WidgetRoles roles( widgetRoles( widget ) );
+
         // install animation timers
         // for optimization, one should put with most used widgets here first
 
         // buttons
-        if( qobject_cast<QToolButton*>(widget) )
+        if( roles & RoleToolButton )
         {
 
             _toolButtonEngine->registerWidget( widget, AnimationHover|AnimationFocus );
             _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus );
 
-        } else if( qobject_cast<QCheckBox*>(widget) || qobject_cast<QRadioButton*>(widget) ) {
+        } else if( roles & (RoleCheckBox|RoleRadioButton) ) {
 
             _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus|AnimationPressed );
 
-        } else if( qobject_cast<QAbstractButton*>(widget) ) {
+        } else if( roles & RoleAbstractButton ) {
 
             // register to toolbox engine if needed
-            if( qobject_cast<QToolBox*>( widget->parent() ) )
+            if( widgetRoles( widget->parent() ) & RoleToolBox )
             { _toolBoxEngine->registerWidget( widget ); }
 
             _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus );
@@ -137,59 +153,58 @@ namespace Breeze
         }
 
         // groupboxes
-        else if( QGroupBox* groupBox = qobject_cast<QGroupBox*>( widget ) )
+        else if( roles & RoleGroupBox )
         {
-            if( groupBox->isCheckable() )
+            if( static_cast<QGroupBox*>( widget )->isCheckable() )
             { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
         }
 
         // sliders
-        else if( qobject_cast<QScrollBar*>( widget ) ) { _scrollBarEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( qobject_cast<QSlider*>( widget ) ) { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( qobject_cast<QDial*>( widget ) ) { _dialEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( roles & RoleScrollBar ) { _scrollBarEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( roles & RoleSlider ) { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( roles & RoleDial ) { _dialEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         // progress bar
-        else if( qobject_cast<QProgressBar*>( widget ) ) { _busyIndicatorEngine->registerWidget( widget ); }
+        else if( roles & RoleProgressBar ) { _busyIndicatorEngine->registerWidget( widget ); }
 
         // combo box
-        else if( qobject_cast<QComboBox*>( widget ) ) {
+        else if( roles & RoleComboBox ) {
             _comboBoxEngine->registerWidget( widget, AnimationHover );
             _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus );
         }
 
         // spinbox
-        else if( qobject_cast<QSpinBox*>( widget ) ) {
+        else if( roles & RoleSpinBox ) {
             _spinBoxEngine->registerWidget( widget );
             _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus );
         }
 
         // editors
-        else if( qobject_cast<QLineEdit*>( widget ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( qobject_cast<QTextEdit*>( widget ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( widget->inherits( "KTextEditor::View" ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( roles & (RoleLineEdit|RoleTextEdit|RoleKTextEditorView) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         // header views
         // need to come before abstract item view, otherwise is skipped
-        else if( qobject_cast<QHeaderView*>( widget ) ) { _headerViewEngine->registerWidget( widget ); }
+        else if( roles & RoleHeaderView ) { _headerViewEngine->registerWidget( widget ); }
 
         // lists
-        else if( qobject_cast<QAbstractItemView*>( widget ) )
+        else if( roles & RoleAbstractItemView )
         { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         // tabbar
-        else if( qobject_cast<QTabBar*>( widget ) ) { _tabBarEngine->registerWidget( widget ); }
+        else if( roles & RoleTabBar ) { _tabBarEngine->registerWidget( widget ); }
 
         // scrollarea
-        else if( QAbstractScrollArea* scrollArea = qobject_cast<QAbstractScrollArea*>( widget ) ) {
+        else if( roles & RoleAbstractScrollArea ) {
 
+            QAbstractScrollArea* scrollArea( static_cast<QAbstractScrollArea*>( widget ) );
             if( scrollArea->frameShadow() == QFrame::Sunken && (widget->focusPolicy()&Qt::StrongFocus) )
             { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         }
 
         // stacked widgets
-        if( QStackedWidget* stack = qobject_cast<QStackedWidget*>( widget ) )
-        { _stackedWidgetEngine->registerWidget( stack ); }
+        if( roles & RoleStackedWidget )
+        { _stackedWidgetEngine->registerWidget( static_cast<QStackedWidget*>( widget ) ); }
 
         
     }
@@ -213,6 +228,30 @@ namespace Breeze
 
     }
 
+    //_______________________________________________________________
+    Animation* Animations::takeAnimation( int duration )
+    {
+
+        while( !_animationPool.isEmpty() )
+        {
+            const Animation::Pointer animation( _animationPool.takeLast() );
+            if( !animation ) continue;
+
+            animation.data()->setDuration( duration );
+            return animation.data();
+        }
+
+        return new Animation( duration, this );
+
+    }
+
+    //_______________________________________________________________
+    void Animations::releaseAnimation( Animation* animation )
+    {
+        if( _animationPool.size() < s_animationPoolSize ) _animationPool.append( animation );
+        else animation->deleteLater();
+    }
+
     //_______________________________________________________________
     void Animations::unregisterEngine( QObject* object )
     {
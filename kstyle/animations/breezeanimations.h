@@ -47,6 +47,9 @@ namespace Breeze
         //* constructor
         explicit Animations( QObject* );
 
+        //* destructor
+        virtual ~Animations();
+
         //* register animations corresponding to given widget, depending on its type.
         void registerWidget( QWidget* widget ) const;
 
@@ -104,6 +107,17 @@ namespace Breeze
         //* setup engines
         void setupEngines();
 
+        //*@name idle animation objects, shared by all generic data
+        //@{
+
+        //* take an idle animation from the pool, or create a new one
+        Animation* takeAnimation( int duration );
+
+        //* give a finished animation back to the pool
+        void releaseAnimation( Animation* );
+
+        //@}
+
         protected Q_SLOTS:
 
         //* enregister engine
@@ -113,6 +127,9 @@ namespace Breeze
         //* register new engine
         void registerEngine( BaseEngine* );
 
+        //* idle animations
+        QList<Animation::Pointer> _animationPool;
+
         //* busy indicator
         BusyIndicatorEngine* _busyIndicatorEngine = nullptr;
 
@@ -22,6 +22,7 @@
 #include "breeze.h"
 
 #include <QVariant>
+#include <QWidget>
 
 namespace Breeze
 {
@@ -80,8 +81,15 @@ namespace Breeze
         DataMap<BusyIndicatorData>::Value data( BusyIndicatorEngine::data( object ) );
         if( data )
         {
-            // update data
-            data.data()->setAnimated( value );
+            // update data and list of animated objects
+            if( data.data()->isAnimated() != value )
+            {
+                data.data()->setAnimated( value );
+
+                const AnimatedObject animatedObject( const_cast<QObject*>( object ) );
+                if( value ) _animatedObjects.append( animatedObject );
+                else _animatedObjects.removeAll( animatedObject );
+            }
 
             // start timer if needed
             if( value )
@@ -125,41 +133,29 @@ namespace Breeze
         // update
         _value = value;
 
-        bool animated( false );
-
-        // loop over objects in map
-        for( DataMap<BusyIndicatorData>::iterator iter = _data.begin(); iter != _data.end(); ++iter )
+        // loop over animated objects only
+        foreach( const AnimatedObject& animatedObject, _animatedObjects )
         {
 
-            if( iter.value().data()->isAnimated() )
+            if( animatedObject._isWidget )
             {
 
-                // update animation flag
-                animated = true;
+                static_cast<QWidget*>( animatedObject._object )->update();
 
-                // emit update signal on object
-                if( const_cast<QObject*>( iter.key() )->inherits( "QQuickStyleItem" ))
-                {
-
-                    //QtQuickControls "rerender" method is updateItem
-                    QMetaObject::invokeMethod( const_cast<QObject*>( iter.key() ), "updateItem", Qt::QueuedConnection);
+            } else if( animatedObject._isStyleItem ) {
 
-                } else {
+                //QtQuickControls "rerender" method is updateItem
+                QMetaObject::invokeMethod( animatedObject._object, "updateItem", Qt::QueuedConnection );
 
-                    QMetaObject::invokeMethod( const_cast<QObject*>( iter.key() ), "update", Qt::QueuedConnection);
+            } else {
 
-                }
+                QMetaObject::invokeMethod( animatedObject._object, "update", Qt::QueuedConnection );
 
             }
 
         }
 
-        if( _animation && !animated )
-        {
-            _animation.data()->stop();
-            _animation.data()->deleteLater();
-            _animation.clear();
-        }
+        if( _animatedObjects.isEmpty() ) stopAnimation();
 
     }
 
@@ -167,14 +163,19 @@ namespace Breeze
     bool BusyIndicatorEngine::unregisterWidget( QObject* object )
     {
         const bool removed( _data.unregisterWidget( object ) );
-        if( _animation && _data.isEmpty() )
-        {
-            _animation.data()->stop();
-            _animation.data()->deleteLater();
-            _animation.clear();
-        }
+        _animatedObjects.removeAll( AnimatedObject( object ) );
 
+        if( _data.isEmpty() ) stopAnimation();
         return removed;
     }
 
+    //__________________________________________________________
+    void BusyIndicatorEngine::stopAnimation()
+    {
+        if( !_animation ) return;
+        _animation.data()->stop();
+        _animation.data()->deleteLater();
+        _animation.clear();
+    }
+
 }
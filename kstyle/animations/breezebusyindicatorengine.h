@@ -25,6 +25,8 @@
 #include "breezebusyindicatordata.h"
 #include "breezedatamap.h"
 
+#include <QList>
+
 namespace Breeze
 {
 
@@ -85,8 +87,42 @@ namespace Breeze
         //* returns data associated to widget
         DataMap<BusyIndicatorData>::Value data( const QObject* );
 
+        //* stop and delete animation
+        void stopAnimation();
+
         private:
 
+        //* animated target
+        class AnimatedObject
+        {
+            public:
+
+            //* constructor
+            explicit AnimatedObject( QObject* object = nullptr ):
+                _object( object ),
+                _isWidget( object && object->isWidgetType() ),
+                _isStyleItem( object && object->inherits( "QQuickStyleItem" ) )
+            {}
+
+            //* equal to operator
+            bool operator == ( const AnimatedObject& other ) const
+            { return _object == other._object; }
+
+            //* object
+            QObject* _object;
+
+            //* true if object is a widget
+            bool _isWidget;
+
+            //* true if object is a QtQuickControls style item
+            bool _isStyleItem;
+
+        };
+
+        //* currently animated objects
+        /** only these need to be updated when value changes */
+        QList<AnimatedObject> _animatedObjects;
+
         //* map widgets to progressbar data
         DataMap<BusyIndicatorData> _data;
 
@@ -23,25 +23,30 @@
 #include "breeze.h"
 
 #include <QObject>
-#include <QMap>
+#include <QHash>
 #include <QPaintDevice>
 
 namespace Breeze
 {
 
     //* data map
-    /** it maps templatized data object to associated object */
-    template< typename K, typename T > class BaseDataMap: public QMap< const K*, WeakPointer<T> >
+    /**
+    it maps templatized data object to associated object.
+    A hash is used rather than an ordered map, since lookups by pointer happen on every paint
+    and ordering is never needed
+    */
+    template< typename K, typename T > class BaseDataMap: public QHash< const K*, WeakPointer<T> >
     {
 
         public:
 
         using Key = const K*;
         using Value = WeakPointer<T>;
+        using Container = QHash<Key, Value>;
 
         //* constructor
         BaseDataMap():
-            QMap<Key, Value>(),
+            Container(),
             _enabled( true ),
             _lastKey( NULL )
         {}
@@ -51,10 +56,18 @@ namespace Breeze
         {}
 
         //* insertion
-        virtual typename QMap< Key, Value >::iterator insert( const Key& key, const Value& value, bool enabled = true )
+        virtual typename Container::iterator insert( const Key& key, const Value& value, bool enabled = true )
         {
             if( value ) value.data()->setEnabled( enabled );
-            return QMap< Key, Value >::insert( key, value );
+
+            // invalidate last value, which may have been looked up before insertion
+            if( key == _lastKey )
+            {
+                _lastKey = NULL;
+                _lastValue.clear();
+            }
+
+            return Container::insert( key, value );
         }
 
         //* find value
@@ -64,8 +77,8 @@ namespace Breeze
             if( key == _lastKey ) return _lastValue;
             else {
                 Value out;
-                typename QMap<Key, Value>::iterator iter( QMap<Key, Value>::find( key ) );
-                if( iter != QMap<Key, Value>::end() ) out = iter.value();
+                typename Container::const_iterator iter( Container::constFind( key ) );
+                if( iter != Container::constEnd() ) out = iter.value();
                 _lastKey = key;
                 _lastValue = out;
                 return out;
@@ -89,12 +102,12 @@ namespace Breeze
             }
 
             // find key in map
-            typename QMap<Key, Value>::iterator iter( QMap<Key, Value>::find( key ) );
-            if( iter == QMap<Key, Value>::end() ) return false;
+            typename Container::iterator iter( Container::find( key ) );
+            if( iter == Container::end() ) return false;
 
             // delete value from map if found
             if( iter.value() ) iter.value().data()->deleteLater();
-            QMap<Key, Value>::erase( iter );
+            Container::erase( iter );
 
             return true;
 
@@ -19,6 +19,8 @@
 
 #include "breezegenericdata.h"
 
+#include "breezeanimations.h"
+
 #include <QTextStream>
 
 namespace Breeze
@@ -27,8 +29,62 @@ namespace Breeze
     //______________________________________________
     GenericData::GenericData( QObject* parent, QWidget* target, int duration ):
         AnimationData( parent, target ),
-        _animation( new Animation( duration, this ) ),
+        _duration( duration ),
         _opacity(0)
-    { setupAnimation( _animation, "opacity" ); }
+    {
+
+        // find the animations object that owns the engine, and the animation pool
+        for( QObject* object = parent; object && !_animations; object = object->parent() )
+        { _animations = qobject_cast<Animations*>( object ); }
+
+    }
+
+    //______________________________________________
+    GenericData::~GenericData()
+    {
+        if( _animation )
+        {
+            _animation.data()->stop();
+            releaseAnimation();
+        }
+    }
+
+    //______________________________________________
+    void GenericData::startAnimation( Animation::Direction direction )
+    {
+
+        if( !_animation )
+        {
+
+            // take animation from pool, or create a new one
+            if( _animations ) _animation = _animations.data()->takeAnimation( _duration );
+            else _animation = new Animation( _duration, this );
+
+            setupAnimation( _animation, "opacity" );
+            connect( _animation.data(), SIGNAL(finished()), SLOT(releaseAnimation()) );
+
+        }
+
+        _animation.data()->setDirection( direction );
+        if( !_animation.data()->isRunning() ) _animation.data()->start();
+
+    }
+
+    //______________________________________________
+    void GenericData::releaseAnimation()
+    {
+
+        if( !_animation ) return;
+
+        Animation* animation( _animation.data() );
+        _animation.clear();
+
+        animation->disconnect( this );
+        animation->setTargetObject( nullptr );
+
+        if( _animations ) _animations.data()->releaseAnimation( animation );
+        else animation->deleteLater();
+
+    }
 
 }
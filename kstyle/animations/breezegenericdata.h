@@ -28,6 +28,7 @@
 namespace Breeze
 {
 
+    class Animations;
 
     //* generic data
     class GenericData: public AnimationData
@@ -44,16 +45,19 @@ namespace Breeze
         GenericData( QObject* parent, QWidget* widget, int duration );
 
         //* destructor
-        virtual ~GenericData()
-        {}
+        virtual ~GenericData();
 
         //* return animation object
+        /** it is only valid while a transition is running */
         virtual const Animation::Pointer& animation() const
         { return _animation; }
 
         //* duration
         virtual void setDuration( int duration )
-        { _animation.data()->setDuration( duration ); }
+        {
+            _duration = duration;
+            if( _animation ) _animation.data()->setDuration( duration );
+        }
 
         //* opacity
         virtual qreal opacity() const
@@ -71,11 +75,27 @@ namespace Breeze
 
         }
 
+        protected:
+
+        //* start animation in a given direction, taking an animation object from the pool if needed
+        void startAnimation( Animation::Direction );
+
+        protected Q_SLOTS:
+
+        //* give animation object back to the pool once finished
+        void releaseAnimation();
+
         private:
 
+        //* animations, owning the pool of idle animation objects
+        WeakPointer<Animations> _animations;
+
         //* animation handling
         Animation::Pointer _animation;
 
+        //* duration
+        int _duration;
+
         //* opacity variable
         qreal _opacity;
 
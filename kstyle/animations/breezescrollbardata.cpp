@@ -136,12 +136,34 @@ namespace Breeze
         QScrollBar* scrollBar( qobject_cast<QScrollBar*>( object ) );
         if( !scrollBar || scrollBar->isSliderDown() ) return;
 
-        // retrieve scrollbar option
-        QStyleOptionSlider opt( qt_qscrollbarStyleOption( scrollBar ) );
-
         // cast event
         QHoverEvent *hoverEvent = static_cast<QHoverEvent*>(event);
-        QStyle::SubControl hoverControl = scrollBar->style()->hitTestComplexControl(QStyle::CC_ScrollBar, &opt, hoverEvent->pos(), scrollBar);
+
+        // update groove rect if scrollbar state has changed
+        Geometry geometry;
+        geometry._size = scrollBar->size();
+        geometry._minimum = scrollBar->minimum();
+        geometry._maximum = scrollBar->maximum();
+        geometry._value = scrollBar->sliderPosition();
+        geometry._pageStep = scrollBar->pageStep();
+        geometry._orientation = scrollBar->orientation();
+        geometry._direction = scrollBar->layoutDirection();
+        if( !( _geometryValid && geometry == _geometry ) )
+        {
+            const QStyleOptionSlider opt( qt_qscrollbarStyleOption( scrollBar ) );
+            _grooveRect = scrollBar->style()->subControlRect( QStyle::CC_ScrollBar, &opt, QStyle::SC_ScrollBarGroove, scrollBar );
+            _geometry = geometry;
+            _geometryValid = true;
+        }
+
+        // only arrows hover state is tracked. Points in the groove never hit them, so that
+        // full hit test is only needed over the arrows
+        QStyle::SubControl hoverControl( QStyle::SC_ScrollBarGroove );
+        if( !_grooveRect.contains( hoverEvent->pos() ) )
+        {
+            const QStyleOptionSlider opt( qt_qscrollbarStyleOption( scrollBar ) );
+            hoverControl = scrollBar->style()->hitTestComplexControl( QStyle::CC_ScrollBar, &opt, hoverEvent->pos(), scrollBar );
+        }
 
         // update hover state
         updateAddLineArrow( hoverControl );
@@ -102,8 +102,10 @@ namespace Breeze
         }
 
         //* duration
+        /** it is also called on configuration changes, which may change scrollbar buttons layout */
         virtual void setDuration( int duration )
         {
+            _geometryValid = false;
             WidgetStateData::setDuration( duration );
             addLineAnimation().data()->setDuration( duration );
             subLineAnimation().data()->setDuration( duration );
@@ -256,6 +258,44 @@ namespace Breeze
         //* groove data
         Data _grooveData;
 
+        //* scrollbar state on which groove rect depends
+        class Geometry
+        {
+
+            public:
+
+            //* equal to operator
+            bool operator == ( const Geometry& other ) const
+            {
+                return
+                    _size == other._size &&
+                    _minimum == other._minimum &&
+                    _maximum == other._maximum &&
+                    _value == other._value &&
+                    _pageStep == other._pageStep &&
+                    _orientation == other._orientation &&
+                    _direction == other._direction;
+            }
+
+            QSize _size;
+            int _minimum = 0;
+            int _maximum = 0;
+            int _value = 0;
+            int _pageStep = 0;
+            Qt::Orientation _orientation = Qt::Horizontal;
+            Qt::LayoutDirection _direction = Qt::LeftToRight;
+
+        };
+
+        //* scrollbar state matching cached groove rect
+        Geometry _geometry;
+
+        //* groove rect, cached for hover tracking
+        QRect _grooveRect;
+
+        //* true if groove rect is valid
+        bool _geometryValid = false;
+
         //* mouse position
         QPoint _position;
 
@@ -26,9 +26,13 @@
 
 #include "breezestackedwidgetdata.h"
 
+#include <cmath>
+
 namespace Breeze
 {
 
+    const qreal StackedWidgetData::MinGrabScale = 0.25;
+
     //______________________________________________________
     StackedWidgetData::StackedWidgetData( QObject* parent, QStackedWidget* target, int duration ):
         TransitionData( parent, target, duration ),
@@ -73,12 +77,18 @@ namespace Breeze
         {
 
             transition().data()->setOpacity( 0 );
+            transition().data()->setGrabScale( _grabScale );
             startClock();
             transition().data()->setGeometry( widget->geometry() );
             transition().data()->setStartPixmap( transition().data()->grab( widget ) );
 
             _index = _target.data()->currentIndex();
-            return !slow();
+
+            // the grab is done and fading a pixmap is cheap, so only give up
+            // when grabbing is slow even at the lowest resolution
+            const bool abort( slow() && _grabScale <= MinGrabScale );
+            updateGrabScale( elapsed() );
+            return !abort;
 
         } else {
 
@@ -129,6 +139,25 @@ namespace Breeze
 
     }
 
+    //___________________________________________________________________
+    void StackedWidgetData::updateGrabScale( int elapsed )
+    {
+
+        // grab time scales roughly with the grabbed area
+        const int maxRenderTime( this->maxRenderTime() );
+        if( elapsed > maxRenderTime )
+        {
+
+            _grabScale = qMax( MinGrabScale, _grabScale*std::sqrt( qreal( maxRenderTime )/elapsed ) );
+
+        } else if( _grabScale < 1.0 && 2*elapsed < maxRenderTime ) {
+
+            _grabScale = qMin<qreal>( 1.0, _grabScale*std::sqrt( qreal( maxRenderTime )/qMax( 1, 2*elapsed ) ) );
+
+        }
+
+    }
+
     //___________________________________________________________________
     void StackedWidgetData::targetDestroyed()
     {
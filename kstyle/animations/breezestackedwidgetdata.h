@@ -65,12 +65,22 @@ namespace Breeze
 
         private:
 
+        //! update grab scale from last grab time
+        void updateGrabScale( int elapsed );
+
+        //! minimum grab scale
+        static const qreal MinGrabScale;
+
         //! target
         WeakPointer<QStackedWidget> _target;
 
         //! current index
         int _index;
 
+        //! scale used for next grab
+        /*! it is reduced when grabbing is slower than max render time, and restored when it gets fast again */
+        qreal _grabScale = 1.0;
+
     };
 
 }
@@ -80,6 +80,10 @@ namespace Breeze
             else _clock.restart();
         }
 
+        //* time elapsed since clock was started (ms)
+        int elapsed() const
+        { return _clock.isNull() ? 0 : _clock.elapsed(); }
+
         //* check if rendering is two slow
         bool slow() const
         { return !( _clock.isNull() || _clock.elapsed() <= maxRenderTime() ); }
@@ -70,8 +70,8 @@ namespace Breeze
         if( !rect.isValid() ) rect = widget->rect();
         if( !rect.isValid() ) return QPixmap();
 
-        // initialize pixmap
-        QPixmap out( rect.size() );
+        // initialize pixmap, at reduced resolution if requested
+        QPixmap out( _grabScale < 1.0 ? rect.size()*_grabScale : rect.size() );
         out.fill( Qt::transparent );
         _paintEnabled = false;
 
@@ -130,74 +130,52 @@ namespace Breeze
         QRect rect = event->rect();
         if( !rect.isValid() ) rect = this->rect();
 
-        // local pixmap
+        // paint directly on widget, or on persistent local buffer
+        QPainter p;
         const bool paintOnWidget( testFlag( PaintOnWidget ) && !testFlag( Transparent ) );
-        if( !paintOnWidget )
-        {
+        if( paintOnWidget ) p.begin( this );
+        else {
 
             if( _currentPixmap.isNull() || _currentPixmap.size() != size() )
             { _currentPixmap = QPixmap( size() ); }
 
+            // erase updated rect only
+            p.begin( &_currentPixmap );
+            p.setCompositionMode( QPainter::CompositionMode_Source );
+            p.fillRect( rect, Qt::transparent );
+            p.setCompositionMode( QPainter::CompositionMode_SourceOver );
+
         }
 
-        // fill
-        _currentPixmap.fill( Qt::transparent );
+        p.setClipRect( rect );
 
-        // copy local pixmap to current
+        // pixmaps are blended using painter opacity, without intermediate faded copies
+        // draw end pixmap first, provided that opacity is small enough
+        if( opacity() >= 0.004 && !_endPixmap.isNull() )
         {
 
-            QPainter p;
-
-            // draw end pixmap first, provided that opacity is small enough
-            if( opacity() >= 0.004 && !_endPixmap.isNull() )
-            {
-
-                // faded endPixmap if parent target is transparent and opacity is
-                if( opacity() <= 0.996 && testFlag( Transparent ) )
-                {
-
-                    fade( _endPixmap, _currentPixmap, opacity(), rect );
-                    p.begin( &_currentPixmap );
-                    p.setClipRect( event->rect() );
-
-                } else {
+            // end pixmap must also be faded if parent target is transparent
+            if( opacity() <= 0.996 && testFlag( Transparent ) ) p.setOpacity( opacity() );
+            drawPixmap( &p, _endPixmap );
 
-                    if( paintOnWidget ) p.begin( this );
-                    else p.begin( &_currentPixmap );
-                    p.setClipRect( event->rect() );
-                    p.drawPixmap( QPoint(), _endPixmap );
-
-                }
-
-            } else {
-
-                if( paintOnWidget ) p.begin( this );
-                else p.begin( &_currentPixmap );
-                p.setClipRect( event->rect() );
-
-            }
-
-            // draw fading start pixmap
-            if( opacity() <= 0.996 && !_startPixmap.isNull() )
-            {
-                if( opacity() >= 0.004 )
-                {
-
-                    fade( _startPixmap, _localStartPixmap, 1.0-opacity(), rect );
-                    p.drawPixmap( QPoint(), _localStartPixmap );
+        }
 
-                } else p.drawPixmap( QPoint(), _startPixmap );
+        // draw fading start pixmap
+        if( opacity() <= 0.996 && !_startPixmap.isNull() )
+        {
 
-            }
+            p.setOpacity( opacity() >= 0.004 ? 1.0 - opacity() : 1.0 );
+            drawPixmap( &p, _startPixmap );
 
-            p.end();
         }
 
+        p.end();
+
         // copy current pixmap on widget
         if( !paintOnWidget )
         {
-            QPainter p( this );
-            p.setClipRect( event->rect() );
+            p.begin( this );
+            p.setClipRect( rect );
             p.drawPixmap( QPoint(0,0), _currentPixmap );
             p.end();
         }
@@ -232,6 +210,7 @@ namespace Breeze
 
         // painting
         QPainter p(&pixmap);
+        if( _grabScale < 1.0 ) p.scale( _grabScale, _grabScale );
         p.setClipRect( rect );
         const QBrush backgroundBrush = parent->palette().brush( parent->backgroundRole());
         if( backgroundBrush.style() == Qt::TexturePattern)
@@ -241,7 +220,7 @@ namespace Breeze
 
         } else {
 
-            p.fillRect( pixmap.rect(), backgroundBrush );
+            p.fillRect( QRect( QPoint(), rect.size() ), backgroundBrush );
 
         }
 
@@ -272,37 +251,31 @@ namespace Breeze
 
     //________________________________________________
     void TransitionWidget::grabWidget( QPixmap& pixmap, QWidget* widget, QRect& rect ) const
-    { widget->render( &pixmap, pixmap.rect().topLeft(), rect, QWidget::DrawChildren ); }
-
-    //________________________________________________
-    void TransitionWidget::fade( const QPixmap& source, QPixmap& target, qreal opacity, const QRect& rect ) const
     {
 
-        if( target.isNull() || target.size() != size() )
-        { target = QPixmap( size() ); }
+        if( _grabScale < 1.0 )
+        {
 
-        // erase target
-        target.fill( Qt::transparent );
+            QPainter p( &pixmap );
+            p.scale( _grabScale, _grabScale );
+            widget->render( &p, QPoint(), rect, QWidget::DrawChildren );
 
-        // check opacity
-        if( opacity*255 < 1 ) return;
+        } else widget->render( &pixmap, pixmap.rect().topLeft(), rect, QWidget::DrawChildren );
 
-        QPainter p( &target );
-        p.setClipRect( rect );
+    }
 
-        // draw pixmap
-        p.drawPixmap( QPoint(0,0), source );
+    //________________________________________________
+    void TransitionWidget::drawPixmap( QPainter* painter, const QPixmap& pixmap ) const
+    {
+
+        if( _grabScale >= 1.0 || pixmap.size() == size() ) painter->drawPixmap( QPoint(), pixmap );
+        else {
+
+            painter->setRenderHint( QPainter::SmoothPixmapTransform, true );
+            painter->drawPixmap( rect(), pixmap );
 
-        // opacity mask (0.996 corresponds to 254/255)
-        if( opacity <= 0.996 )
-        {
-            p.setCompositionMode(QPainter::CompositionMode_DestinationIn);
-            QColor color( Qt::black );
-            color.setAlphaF( opacity );
-            p.fillRect(rect, color );
         }
 
-        p.end();
-   }
+    }
 
 }
@@ -149,6 +149,18 @@ namespace Breeze
 
         //@}
 
+        //* grab scale
+        /**
+        pixmaps are grabbed at reduced resolution when scale is smaller than one,
+        and upscaled when painted. It is ignored when grabbing from window
+        */
+        void setGrabScale( qreal value )
+        { _grabScale = qBound<qreal>( 0.1, value, 1.0 ); }
+
+        //* grab scale
+        qreal grabScale() const
+        { return _grabScale; }
+
         //* grap pixmap
         QPixmap grab( QWidget* = nullptr, QRect = QRect() );
 
@@ -189,8 +201,8 @@ namespace Breeze
         //* grab widget
         virtual void grabWidget( QPixmap&, QWidget*, QRect& ) const;
 
-        //* fade pixmap
-        virtual void fade( const QPixmap& source, QPixmap& target, qreal opacity, const QRect& ) const;
+        //* draw pixmap over the full widget, upscaling if needed
+        void drawPixmap( QPainter*, const QPixmap& ) const;
 
         //* apply step
         virtual qreal digitize( const qreal& value ) const
@@ -213,10 +225,7 @@ namespace Breeze
         //* animation starting pixmap
         QPixmap _startPixmap;
 
-        //* animation starting pixmap
-        QPixmap _localStartPixmap;
-
-        //* animation starting pixmap
+        //* animation ending pixmap
         QPixmap _endPixmap;
 
         //* current pixmap
@@ -225,6 +234,9 @@ namespace Breeze
         //* current state opacity
         qreal _opacity = 0;
 
+        //* grab scale
+        qreal _grabScale = 1.0;
+
         //* steps
         static int _steps;
 
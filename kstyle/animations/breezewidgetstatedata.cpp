@@ -39,8 +39,7 @@ namespace Breeze
         } else {
 
             _state = value;
-            animation().data()->setDirection( _state ? Animation::Forward : Animation::Backward );
-            if( !animation().data()->isRunning() ) animation().data()->start();
+            startAnimation( _state ? Animation::Forward : Animation::Backward );
             return true;
 
         }
@@ -22,6 +22,8 @@
 
 #include "breezeenabledata.h"
 
+#include <QEvent>
+
 namespace Breeze
 {
 
@@ -30,10 +32,14 @@ namespace Breeze
     {
 
         if( !widget ) return false;
-        if( mode&AnimationHover && !_hoverData.contains( widget ) ) { _hoverData.insert( widget, new WidgetStateData( this, widget, duration() ), enabled() ); }
-        if( mode&AnimationFocus && !_focusData.contains( widget ) ) { _focusData.insert( widget, new WidgetStateData( this, widget, duration() ), enabled() ); }
-        if( mode&AnimationEnable && !_enableData.contains( widget ) ) { _enableData.insert( widget, new EnableData( this, widget, duration() ), enabled() ); }
-        if( mode&AnimationPressed && !_pressedData.contains( widget ) ) { _pressedData.insert( widget, new WidgetStateData( this, widget, duration() ), enabled() ); }
+        if( mode&AnimationHover && !_hoverData.contains( widget ) && !_hoverStates.contains( widget ) ) { _hoverStates.insert( widget, WidgetState( widget ) ); }
+        if( mode&AnimationFocus && !_focusData.contains( widget ) && !_focusStates.contains( widget ) ) { _focusStates.insert( widget, WidgetState( widget ) ); }
+        if( mode&AnimationEnable && !_enableData.contains( widget ) && !_enableStates.contains( widget ) )
+        {
+            _enableStates.insert( widget, WidgetState( widget ) );
+            widget->installEventFilter( this );
+        }
+        if( mode&AnimationPressed && !_pressedData.contains( widget ) && !_pressedStates.contains( widget ) ) { _pressedStates.insert( widget, WidgetState( widget ) ); }
 
         // connect destruction signal
         connect( widget, SIGNAL(destroyed(QObject*)), this, SLOT(unregisterWidget(QObject*)), Qt::UniqueConnection );
@@ -54,24 +60,36 @@ namespace Breeze
         {
             foreach( const Value& value, _hoverData )
             { if( value ) out.insert( value.data()->target().data() ); }
+
+            foreach( const WidgetState& state, _hoverStates )
+            { out.insert( state._widget ); }
         }
 
         if( mode&AnimationFocus )
         {
             foreach( const Value& value, _focusData )
             { if( value ) out.insert( value.data()->target().data() ); }
+
+            foreach( const WidgetState& state, _focusStates )
+            { out.insert( state._widget ); }
         }
 
         if( mode&AnimationEnable )
         {
             foreach( const Value& value, _enableData )
             { if( value ) out.insert( value.data()->target().data() ); }
+
+            foreach( const WidgetState& state, _enableStates )
+            { out.insert( state._widget ); }
         }
 
         if( mode&AnimationPressed )
         {
             foreach( const Value& value, _pressedData )
             { if( value ) out.insert( value.data()->target().data() ); }
+
+            foreach( const WidgetState& state, _pressedStates )
+            { out.insert( state._widget ); }
         }
 
         return out;
@@ -82,7 +100,56 @@ namespace Breeze
     bool WidgetStateEngine::updateState( const QObject* object, AnimationMode mode, bool value )
     {
         DataMap<WidgetStateData>::Value data( WidgetStateEngine::data( object, mode ) );
-        return ( data && data.data()->updateState( value ) );
+        if( data ) return data.data()->updateState( value );
+
+        // check state record
+        StateMap* states( stateMap( mode ) );
+        if( !( states && object && dataMap( mode ).enabled() ) ) return false;
+
+        StateMap::iterator iter( states->find( object ) );
+        if( iter == states->end() ) return false;
+
+        WidgetState& state( iter.value() );
+        if( !state._initialized )
+        {
+
+            state._state = value;
+            state._initialized = true;
+            return false;
+
+        } else if( state._state == value ) return false;
+
+        // state changes for the first time. Create animation data, initialized with recorded state
+        WidgetStateData* stateData( new WidgetStateData( this, state._widget, mode == AnimationPressed ? duration()/2 : duration() ) );
+        stateData->updateState( state._state );
+        states->erase( iter );
+
+        dataMap( mode ).insert( object, stateData, enabled() );
+        return stateData->updateState( value );
+
+    }
+
+    //____________________________________________________________
+    bool WidgetStateEngine::eventFilter( QObject* object, QEvent* event )
+    {
+
+        if( event->type() != QEvent::EnabledChange || !enabled() ) return BaseEngine::eventFilter( object, event );
+
+        StateMap::iterator iter( _enableStates.find( object ) );
+        if( iter == _enableStates.end() ) return BaseEngine::eventFilter( object, event );
+
+        // enability changes for the first time. Create enable data, which handles later changes itself.
+        // As when enable data were created at registration, the first change only initializes the state
+        QWidget* widget( iter.value()._widget );
+        _enableStates.erase( iter );
+        widget->removeEventFilter( this );
+
+        EnableData* enableData( new EnableData( this, widget, duration() ) );
+        _enableData.insert( widget, enableData, enabled() );
+        enableData->updateState( widget->isEnabled() );
+
+        return BaseEngine::eventFilter( object, event );
+
     }
 
     //____________________________________________________________
@@ -109,6 +176,20 @@ namespace Breeze
 
     }
 
+    //____________________________________________________________
+    WidgetStateEngine::StateMap* WidgetStateEngine::stateMap( AnimationMode mode )
+    {
+
+        switch( mode )
+        {
+            case AnimationHover: return &_hoverStates;
+            case AnimationFocus: return &_focusStates;
+            case AnimationPressed: return &_pressedStates;
+            default: return nullptr;
+        }
+
+    }
+
     //____________________________________________________________
     DataMap<WidgetStateData>& WidgetStateEngine::dataMap( AnimationMode mode )
     {
@@ -25,6 +25,8 @@
 #include "breezedatamap.h"
 #include "breezewidgetstatedata.h"
 
+#include <QHash>
+
 namespace Breeze
 {
 
@@ -48,6 +50,9 @@ namespace Breeze
         //* register widget
         virtual bool registerWidget( QWidget*, AnimationModes );
 
+        //* event filter, used to catch the first enability change of registered widgets
+        virtual bool eventFilter( QObject*, QEvent* );
+
         //* returns registered widgets
         virtual WidgetList registeredWidgets( AnimationModes ) const;
 
@@ -134,6 +139,14 @@ namespace Breeze
             if( _focusData.unregisterWidget( object ) ) found = true;
             if( _enableData.unregisterWidget( object ) ) found = true;
             if( _pressedData.unregisterWidget( object ) ) found = true;
+            if( _hoverStates.remove( object ) ) found = true;
+            if( _focusStates.remove( object ) ) found = true;
+            if( _pressedStates.remove( object ) ) found = true;
+            if( _enableStates.remove( object ) )
+            {
+                object->removeEventFilter( this );
+                found = true;
+            }
             return found;
         }
 
@@ -145,6 +158,35 @@ namespace Breeze
         //* returns data map associated to animation mode
         DataMap<WidgetStateData>& dataMap( AnimationMode );
 
+        //* lightweight record for widgets that have no animation data yet
+        class WidgetState
+        {
+            public:
+
+            //* constructor
+            explicit WidgetState( QWidget* widget = nullptr ):
+                _widget( widget ),
+                _initialized( false ),
+                _state( false )
+            {}
+
+            //* widget
+            QWidget* _widget;
+
+            //* true once state has been set for the first time
+            bool _initialized;
+
+            //* state
+            bool _state;
+
+        };
+
+        //* widget state records, keyed by widget
+        using StateMap = QHash<const QObject*, WidgetState>;
+
+        //* returns state records associated to animation mode, if any
+        StateMap* stateMap( AnimationMode );
+
         private:
 
         //* maps
@@ -153,6 +195,24 @@ namespace Breeze
         DataMap<WidgetStateData> _enableData;
         DataMap<WidgetStateData> _pressedData;
 
+        //*@name state records
+        /**
+        animation data for hover, focus and pressed states are only created
+        the first time the state actually changes. Until then only the state is recorded
+        */
+        //@{
+        StateMap _hoverStates;
+        StateMap _focusStates;
+        StateMap _pressedStates;
+        //@}
+
+        //* enability records
+        /**
+        enable data are only created the first time the widget enability changes,
+        which is caught by the engine, installed as event filter on the recorded widgets
+        */
+        StateMap _enableStates;
+
     };
 
 }
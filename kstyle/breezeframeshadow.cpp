@@ -20,6 +20,7 @@
 #include "breezeframeshadow.h"
 
 #include "breeze.h"
+#include "breezewidgetroles.h"
 
 #include <QDebug>
 #include <QAbstractScrollArea>
@@ -44,9 +45,9 @@ namespace Breeze
         // check whether widget is a frame, and has the proper shape
         bool accepted = false;
 
-        // cast to frame and check
-        QFrame* frame( qobject_cast<QFrame*>( widget ) );
-        if( frame )
+        // check roles
+        const WidgetRoles roles( widgetRoles( widget ) );
+        if( roles & RoleFrame )
         {
 
             // also do not install on QSplitter
@@ -54,12 +55,12 @@ namespace Breeze
             due to Qt, splitters are set with a frame style that matches the condition below,
             though no shadow should be installed, obviously
             */
-            if( qobject_cast<QSplitter*>( widget ) ) return false;
+            if( roles & RoleSplitter ) return false;
 
             // further checks on frame shape, and parent
-            if( frame->frameStyle() == (QFrame::StyledPanel | QFrame::Sunken) ) accepted = true;
+            if( static_cast<QFrame*>( widget )->frameStyle() == (QFrame::StyledPanel | QFrame::Sunken) ) accepted = true;
 
-        } else if( widget->inherits( "KTextEditor::View" ) ) accepted = true;
+        } else if( roles & RoleKTextEditorView ) accepted = true;
 
         if( !accepted ) return false;
 
@@ -67,18 +68,20 @@ namespace Breeze
         QWidget* parent( widget->parentWidget() );
         while( parent && !parent->isTopLevel() )
         {
-            if( parent->inherits( "KHTMLView" ) ) return false;
+            if( widgetRoles( parent ) & RoleKHTMLView ) return false;
             parent = parent->parentWidget();
         }
 
-        // store in set
-        _registeredWidgets.insert( widget );
+        // store in map
+        _registeredWidgets.insert( widget, Shadows() );
 
         // catch object destruction
         connect( widget, SIGNAL(destroyed(QObject*)), SLOT(widgetDestroyed(QObject*)) );
 
-        // install shadow
-        installShadows( widget, helper );
+        // install shadows, or masks for scroll areas
+        QAbstractScrollArea* scrollArea( _overlaysEnabled ? nullptr : qobject_cast<QAbstractScrollArea*>( widget ) );
+        if( scrollArea ) installMasks( scrollArea );
+        else installShadows( widget, helper );
 
         return true;
 
@@ -88,8 +91,8 @@ namespace Breeze
     void FrameShadowFactory::unregisterWidget( QWidget* widget )
     {
         if( !isRegistered( widget ) ) return;
-        _registeredWidgets.remove( widget );
         removeShadows( widget );
+        _registeredWidgets.remove( widget );
     }
 
     //____________________________________________________________________________________
@@ -106,6 +109,40 @@ namespace Breeze
                 break;
             }
 
+            // geometry changes of either the scroll area or its children
+            case QEvent::Move:
+            case QEvent::Resize:
+            {
+                QObject* scrollArea( _registeredWidgets.contains( object ) ? object : object->parent() );
+                if( hasMasks( static_cast<QWidget*>( scrollArea ) ) )
+                { updateMasks( static_cast<QAbstractScrollArea*>( scrollArea ) ); }
+                break;
+            }
+
+            // children set after polish, e.g. with QTreeView::setHeader or QAbstractScrollArea::setViewport
+            case QEvent::ChildAdded:
+            case QEvent::ChildRemoved:
+            {
+                if( !hasMasks( static_cast<QWidget*>( object ) ) ) break;
+                if( !static_cast<QChildEvent*>( event )->child()->isWidgetType() ) break;
+
+                // a removed child may already be destroyed, in which case its guarded pointer is null
+                if( event->type() == QEvent::ChildRemoved )
+                {
+                    QObject* child( static_cast<QChildEvent*>( event )->child() );
+                    ShadowMap::iterator iter( _registeredWidgets.find( object ) );
+                    for( const WeakPointer<QWidget>& maskedChild : iter.value()._maskedChildren )
+                    {
+                        if( maskedChild.data() != child ) continue;
+                        maskedChild.data()->removeEventFilter( this );
+                        maskedChild.data()->clearMask();
+                    }
+                }
+
+                installMasks( static_cast<QAbstractScrollArea*>( object ) );
+                break;
+            }
+
             default: break;
         }
 
@@ -121,11 +158,14 @@ namespace Breeze
 
         widget->installEventFilter(this);
 
+        Shadows shadows;
         widget->installEventFilter( &_addEventFilter );
-        installShadow( widget, helper, SideTop );
-        installShadow( widget, helper, SideBottom );
+        shadows._top = installShadow( widget, helper, SideTop );
+        shadows._bottom = installShadow( widget, helper, SideBottom );
         widget->removeEventFilter( &_addEventFilter );
 
+        _registeredWidgets.insert( widget, shadows );
+
     }
 
     //____________________________________________________________________________________
@@ -134,29 +174,39 @@ namespace Breeze
 
         widget->removeEventFilter( this );
 
-        const QList<QObject* > children = widget->children();
-        foreach( QObject *child, children )
+        ShadowMap::iterator iter( _registeredWidgets.find( widget ) );
+        if( iter == _registeredWidgets.end() ) return;
+
+        if( iter.value()._masked )
         {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow*>(child) )
-            {
-                shadow->hide();
-                shadow->setParent(nullptr);
-                shadow->deleteLater();
-            }
+            for( QWidget* child : maskCandidates( static_cast<QAbstractScrollArea*>( widget ) ) )
+            { child->removeEventFilter( this ); }
+
+            for( const WeakPointer<QWidget>& child : iter.value()._maskedChildren )
+            { if( child ) child.data()->clearMask(); }
+        }
+
+        for( FrameShadow* shadow : { iter.value()._top.data(), iter.value()._bottom.data() } )
+        {
+            if( !shadow ) continue;
+            shadow->hide();
+            shadow->setParent(nullptr);
+            shadow->deleteLater();
         }
 
+        iter.value() = Shadows();
+
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::updateShadowsGeometry( const QObject* object, QRect rect ) const
     {
 
-        const QList<QObject *> children = object->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->updateGeometry( rect ); }
-        }
+        ShadowMap::const_iterator iter( _registeredWidgets.constFind( object ) );
+        if( iter == _registeredWidgets.constEnd() ) return;
+
+        if( iter.value()._top ) iter.value()._top.data()->updateGeometry( rect );
+        if( iter.value()._bottom ) iter.value()._bottom.data()->updateGeometry( rect );
 
     }
 
@@ -164,12 +214,11 @@ namespace Breeze
     void FrameShadowFactory::raiseShadows( QObject* object ) const
     {
 
-        const QList<QObject *> children = object->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->raise(); }
-        }
+        ShadowMap::const_iterator iter( _registeredWidgets.constFind( object ) );
+        if( iter == _registeredWidgets.constEnd() ) return;
+
+        if( iter.value()._top ) iter.value()._top.data()->raise();
+        if( iter.value()._bottom ) iter.value()._bottom.data()->raise();
 
     }
 
@@ -177,12 +226,11 @@ namespace Breeze
     void FrameShadowFactory::update( QObject* object ) const
     {
 
-        const QList<QObject* > children = object->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->update();}
-        }
+        ShadowMap::const_iterator iter( _registeredWidgets.constFind( object ) );
+        if( iter == _registeredWidgets.constEnd() ) return;
+
+        if( iter.value()._top ) iter.value()._top.data()->update();
+        if( iter.value()._bottom ) iter.value()._bottom.data()->update();
 
     }
 
@@ -190,22 +238,101 @@ namespace Breeze
     void FrameShadowFactory::updateState( const QWidget* widget, bool focus, bool hover, qreal opacity, AnimationMode mode ) const
     {
 
-        const QList<QObject *> children = widget->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->updateState( focus, hover, opacity, mode ); }
-        }
+        ShadowMap::const_iterator iter( _registeredWidgets.constFind( widget ) );
+        if( iter == _registeredWidgets.constEnd() ) return;
+
+        if( iter.value()._top ) iter.value()._top.data()->updateState( focus, hover, opacity, mode );
+        if( iter.value()._bottom ) iter.value()._bottom.data()->updateState( focus, hover, opacity, mode );
 
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::installShadow( QWidget* widget, Helper& helper, Side area ) const
+    FrameShadow* FrameShadowFactory::installShadow( QWidget* widget, Helper& helper, Side area ) const
     {
         FrameShadow *shadow(nullptr);
         shadow = new FrameShadow( area, helper );
         shadow->setParent(widget);
         shadow->hide();
+        return shadow;
+    }
+
+    //____________________________________________________________________________________
+    void FrameShadowFactory::installMasks( QAbstractScrollArea* scrollArea )
+    {
+
+        removeShadows( scrollArea );
+
+        scrollArea->installEventFilter( this );
+        for( QWidget* child : maskCandidates( scrollArea ) )
+        { child->installEventFilter( this ); }
+
+        Shadows shadows;
+        shadows._masked = true;
+        _registeredWidgets.insert( scrollArea, shadows );
+
+        updateMasks( scrollArea );
+
+    }
+
+    //____________________________________________________________________________________
+    void FrameShadowFactory::updateMasks( QAbstractScrollArea* scrollArea )
+    {
+
+        ShadowMap::iterator iter( _registeredWidgets.find( scrollArea ) );
+        if( iter == _registeredWidgets.end() ) return;
+        QList<WeakPointer<QWidget>>& maskedChildren( iter.value()._maskedChildren );
+
+        // frame corners, in which the rounded outline overlaps the frame contents
+        QRegion corners;
+        if( scrollArea->frameStyle() == (QFrame::StyledPanel | QFrame::Sunken) )
+        {
+            const QRect rect( scrollArea->rect() );
+            const QSize size( Metrics::Frame_FrameRadius, Metrics::Frame_FrameRadius );
+            corners += QRect( rect.topLeft(), size );
+            corners += QRect( rect.topRight() - QPoint( size.width() - 1, 0 ), size );
+            corners += QRect( rect.bottomLeft() - QPoint( 0, size.height() - 1 ), size );
+            corners += QRect( rect.bottomRight() - QPoint( size.width() - 1, size.height() - 1 ), size );
+        }
+
+        for( QWidget* child : maskCandidates( scrollArea ) )
+        {
+
+            const QRegion region( corners.intersected( child->geometry() ) );
+            if( region.isEmpty() )
+            {
+
+                // only clear masks installed here
+                if( maskedChildren.removeAll( child ) ) child->clearMask();
+
+            } else {
+
+                const QRegion mask( QRegion( child->rect() ).subtracted( region.translated( -child->pos() ) ) );
+                if( child->mask() != mask ) child->setMask( mask );
+                if( !maskedChildren.contains( child ) ) maskedChildren.append( child );
+
+            }
+
+        }
+
+    }
+
+    //____________________________________________________________________________________
+    QList<QWidget*> FrameShadowFactory::maskCandidates( QAbstractScrollArea* scrollArea ) const
+    {
+
+        // all direct children: viewport, headers, scrollbar containers, corner widget, etc.
+        // native children, e.g. OpenGL viewports, are left untouched
+        QList<QWidget*> children;
+        for( QObject* child : scrollArea->children() )
+        {
+            if( !child->isWidgetType() ) continue;
+            QWidget* widget( static_cast<QWidget*>( child ) );
+            if( widget->isWindow() || widget->testAttribute( Qt::WA_NativeWindow ) ) continue;
+            children.append( widget );
+        }
+
+        return children;
+
     }
 
     //____________________________________________________________________________________
@@ -24,9 +24,11 @@
 #include "breezeaddeventfilter.h"
 #include "breezehelper.h"
 
+#include <QAbstractScrollArea>
 #include <QEvent>
+#include <QHash>
+#include <QList>
 #include <QObject>
-#include <QSet>
 
 #include <QWidget>
 #include <QPaintEvent>
@@ -35,6 +37,8 @@
 namespace Breeze
 {
 
+    class FrameShadow;
+
     //* shadow manager
     class FrameShadowFactory: public QObject
     {
@@ -52,6 +56,15 @@ namespace Breeze
         virtual ~FrameShadowFactory()
         {}
 
+        //* enable overlay widgets
+        /**
+        when disabled, children of scroll areas that cover the frame corners get these corners masked instead,
+        so that the outline painted by the frame itself shows through.
+        Only affects widgets registered afterwards
+        */
+        void setOverlaysEnabled( bool value )
+        { _overlaysEnabled = value; }
+
         //* register widget
         bool registerWidget( QWidget*, Helper& );
 
@@ -62,6 +75,10 @@ namespace Breeze
         bool isRegistered( const QWidget* widget ) const
         { return _registeredWidgets.contains( widget ); }
 
+        //* true if widget is registered and uses masks rather than overlay widgets
+        bool hasMasks( const QWidget* widget ) const
+        { return _registeredWidgets.value( widget )._masked; }
+
         //* event filter
         virtual bool eventFilter( QObject*, QEvent*);
 
@@ -86,7 +103,16 @@ namespace Breeze
         void update( QObject* ) const;
 
         //* install shadow on given side
-        void installShadow( QWidget*, Helper&, Side ) const;
+        FrameShadow* installShadow( QWidget*, Helper&, Side ) const;
+
+        //* mask children corners, in place of overlay widgets
+        void installMasks( QAbstractScrollArea* );
+
+        //* update children masks to match the frame corners
+        void updateMasks( QAbstractScrollArea* );
+
+        //* children that may need to be masked
+        QList<QWidget*> maskCandidates( QAbstractScrollArea* ) const;
 
         protected Q_SLOTS:
 
@@ -98,8 +124,32 @@ namespace Breeze
         //* needed to block ChildAdded events when creating shadows
         AddEventFilter _addEventFilter;
 
-        //* set of registered widgets
-        QSet<const QObject*> _registeredWidgets;
+        //* true if overlay widgets are used for scroll areas
+        bool _overlaysEnabled = true;
+
+        //* shadows installed on a registered widget
+        class Shadows
+        {
+            public:
+
+            //* top shadow
+            WeakPointer<FrameShadow> _top;
+
+            //* bottom shadow
+            WeakPointer<FrameShadow> _bottom;
+
+            //* true if children corners are masked instead
+            bool _masked = false;
+
+            //* children with a mask installed
+            QList<WeakPointer<QWidget>> _maskedChildren;
+
+        };
+
+        //* registered widgets and their shadows
+        /** shadows are stored to avoid searching widget children on each update */
+        using ShadowMap = QHash<const QObject*, Shadows>;
+        ShadowMap _registeredWidgets;
 
     };
 
@@ -53,6 +53,14 @@ namespace Breeze
     { init(); }
     #endif
 
+    //____________________________________________________________________
+    Helper::~Helper()
+    {
+        #if !BREEZE_USE_KDE4
+        QObject::disconnect( _compositingConnection );
+        #endif
+    }
+
     //____________________________________________________________________
     KSharedConfig::Ptr Helper::config() const
     { return _config; }
@@ -70,23 +78,25 @@ namespace Breeze
         _activeTitleBarTextColor = group.readEntry( "activeForeground", palette.color( QPalette::Active, QPalette::HighlightedText ) );
         _inactiveTitleBarColor = group.readEntry( "inactiveBackground", palette.color( QPalette::Disabled, QPalette::Highlight ) );
         _inactiveTitleBarTextColor = group.readEntry( "inactiveForeground", palette.color( QPalette::Disabled, QPalette::HighlightedText ) );
+
+        // cached colors and primitives might depend on the configuration
+        _paletteColorCache.clear();
+        _pixmapCache.clear();
+        _tileSetCache.clear();
     }
 
     //____________________________________________________________________
     QColor Helper::frameOutlineColor( const QPalette& palette, bool mouseOver, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor outline( KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.25 ) );
+        QColor outline( derivedColor( palette, ColorFrameOutline ) );
 
         // focus takes precedence over hover
         if( mode == AnimationFocus )
         {
 
-            const QColor focus( focusColor( palette ) );
-            const QColor hover( hoverColor( palette ) );
-
-            if( mouseOver ) outline = KColorUtils::mix( hover, focus, opacity );
-            else outline = KColorUtils::mix( outline, focus, opacity );
+            if( mouseOver ) outline = derivedColor( palette, ColorHover, ColorFocus, opacity );
+            else outline = derivedColor( palette, ColorFrameOutline, ColorFocus, opacity );
 
         } else if( hasFocus ) {
 
@@ -94,8 +104,7 @@ namespace Breeze
 
         } else if( mode == AnimationHover ) {
 
-            const QColor hover( hoverColor( palette ) );
-            outline = KColorUtils::mix( outline, hover, opacity );
+            outline = derivedColor( palette, ColorFrameOutline, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -109,35 +118,34 @@ namespace Breeze
 
     //____________________________________________________________________
     QColor Helper::focusOutlineColor( const QPalette& palette ) const
-    { return KColorUtils::mix( focusColor( palette ), palette.color( QPalette::WindowText ), 0.15 ); }
+    { return derivedColor( palette, ColorFocusOutline ); }
 
     //____________________________________________________________________
     QColor Helper::hoverOutlineColor( const QPalette& palette ) const
-    { return KColorUtils::mix( hoverColor( palette ), palette.color( QPalette::WindowText ), 0.15 ); }
+    { return derivedColor( palette, ColorHoverOutline ); }
 
     //____________________________________________________________________
     QColor Helper::buttonFocusOutlineColor( const QPalette& palette ) const
-    { return KColorUtils::mix( focusColor( palette ), palette.color( QPalette::ButtonText ), 0.15 ); }
+    { return derivedColor( palette, ColorButtonFocusOutline ); }
 
     //____________________________________________________________________
     QColor Helper::buttonHoverOutlineColor( const QPalette& palette ) const
-    { return KColorUtils::mix( hoverColor( palette ), palette.color( QPalette::ButtonText ), 0.15 ); }
+    { return derivedColor( palette, ColorButtonHoverOutline ); }
 
     //____________________________________________________________________
     QColor Helper::sidePanelOutlineColor( const QPalette& palette, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor outline( palette.color( QPalette::Inactive, QPalette::Highlight ) );
-        QColor focus( palette.color( QPalette::Active, QPalette::Highlight ) );
+        QColor outline( derivedColor( palette, ColorSidePanelOutline ) );
 
         if( mode == AnimationFocus )
         {
 
-            outline = KColorUtils::mix( outline, focus, opacity );
+            outline = derivedColor( palette, ColorSidePanelOutline, ColorSidePanelFocus, opacity );
 
         } else if( hasFocus ) {
 
-            outline = focus;
+            outline = derivedColor( palette, ColorSidePanelFocus );
 
         }
 
@@ -166,14 +174,12 @@ namespace Breeze
     QColor Helper::arrowColor( const QPalette& palette, bool mouseOver, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor outline( arrowColor( palette, QPalette::WindowText ) );
+        QColor outline( derivedColor( palette, ColorArrow ) );
         if( mode == AnimationHover )
         {
 
-            const QColor focus( focusColor( palette ) );
-            const QColor hover( hoverColor( palette ) );
-            if( hasFocus ) outline = KColorUtils::mix( focus, hover, opacity );
-            else outline = KColorUtils::mix( outline, hover, opacity );
+            if( hasFocus ) outline = derivedColor( palette, ColorFocus, ColorHover, opacity );
+            else outline = derivedColor( palette, ColorArrow, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -181,8 +187,7 @@ namespace Breeze
 
         } else if( mode == AnimationFocus ) {
 
-            const QColor focus( focusColor( palette ) );
-            outline = KColorUtils::mix( outline, focus, opacity );
+            outline = derivedColor( palette, ColorArrow, ColorFocus, opacity );
 
         } else if( hasFocus ) {
 
@@ -198,22 +203,12 @@ namespace Breeze
     QColor Helper::buttonOutlineColor( const QPalette& palette, bool mouseOver, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor outline( KColorUtils::mix( palette.color( QPalette::Button ), palette.color( QPalette::ButtonText ), 0.3 ) );
+        QColor outline( derivedColor( palette, ColorButtonOutline ) );
         if( mode == AnimationHover )
         {
 
-            if( hasFocus )
-            {
-                const QColor focus( buttonFocusOutlineColor( palette ) );
-                const QColor hover( buttonHoverOutlineColor( palette ) );
-                outline = KColorUtils::mix( focus, hover, opacity );
-
-            } else {
-
-                const QColor hover( hoverColor( palette ) );
-                outline = KColorUtils::mix( outline, hover, opacity );
-
-            }
+            if( hasFocus ) outline = derivedColor( palette, ColorButtonFocusOutline, ColorButtonHoverOutline, opacity );
+            else outline = derivedColor( palette, ColorButtonOutline, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -222,8 +217,7 @@ namespace Breeze
 
         } else if( mode == AnimationFocus ) {
 
-            const QColor focus( buttonFocusOutlineColor( palette ) );
-            outline = KColorUtils::mix( outline, focus, opacity );
+            outline = derivedColor( palette, ColorButtonOutline, ColorButtonFocusOutline, opacity );
 
         } else if( hasFocus ) {
 
@@ -239,16 +233,13 @@ namespace Breeze
     QColor Helper::buttonBackgroundColor( const QPalette& palette, bool mouseOver, bool hasFocus, bool sunken, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor background( sunken ?
-            KColorUtils::mix( palette.color( QPalette::Button ), palette.color( QPalette::ButtonText ), 0.2 ):
-            palette.color( QPalette::Button ) );
+        const DerivedColor backgroundRole( sunken ? ColorButtonSunken:ColorButton );
+        QColor background( derivedColor( palette, backgroundRole ) );
 
         if( mode == AnimationHover )
         {
 
-            const QColor focus( focusColor( palette ) );
-            const QColor hover( hoverColor( palette ) );
-            if( hasFocus ) background = KColorUtils::mix( focus, hover, opacity );
+            if( hasFocus ) background = derivedColor( palette, ColorFocus, ColorHover, opacity );
 
         } else if( mouseOver && hasFocus ) {
 
@@ -256,8 +247,7 @@ namespace Breeze
 
         } else if( mode == AnimationFocus ) {
 
-            const QColor focus( focusColor( palette ) );
-            background = KColorUtils::mix( background, focus, opacity );
+            background = derivedColor( palette, backgroundRole, ColorFocus, opacity );
 
         } else if( hasFocus ) {
 
@@ -274,34 +264,31 @@ namespace Breeze
     {
 
         QColor outline;
-        const QColor hoverColor( this->hoverColor( palette ) );
-        const QColor focusColor( this->focusColor( palette ) );
-        const QColor sunkenColor = alphaColor( palette.color( QPalette::WindowText ), 0.2 );
 
         // hover takes precedence over focus
         if( mode == AnimationHover )
         {
 
-            if( hasFocus ) outline = KColorUtils::mix( focusColor, hoverColor, opacity );
-            else if( sunken ) outline = sunkenColor;
-            else outline = alphaColor( hoverColor, opacity );
+            if( hasFocus ) outline = derivedColor( palette, ColorFocus, ColorHover, opacity );
+            else if( sunken ) outline = derivedColor( palette, ColorToolButtonSunken );
+            else outline = alphaColor( hoverColor( palette ), opacity );
 
         } else if( mouseOver ) {
 
-            outline = hoverColor;
+            outline = hoverColor( palette );
 
         } else if( mode == AnimationFocus ) {
 
-            if( sunken ) outline = KColorUtils::mix( sunkenColor, focusColor, opacity );
-            else outline = alphaColor( focusColor, opacity );
+            if( sunken ) outline = derivedColor( palette, ColorToolButtonSunken, ColorFocus, opacity );
+            else outline = alphaColor( focusColor( palette ), opacity );
 
         } else if( hasFocus ) {
 
-            outline = focusColor;
+            outline = focusColor( palette );
 
         } else if( sunken ) {
 
-            outline = sunkenColor;
+            outline = derivedColor( palette, ColorToolButtonSunken );
 
         }
 
@@ -313,16 +300,14 @@ namespace Breeze
     QColor Helper::sliderOutlineColor( const QPalette& palette, bool mouseOver, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor outline( KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.4 ) );
+        QColor outline( derivedColor( palette, ColorSliderOutline ) );
 
         // hover takes precedence over focus
         if( mode == AnimationHover )
         {
 
-            const QColor hover( hoverColor( palette ) );
-            const QColor focus( focusColor( palette ) );
-            if( hasFocus ) outline = KColorUtils::mix( focus, hover, opacity );
-            else outline = KColorUtils::mix( outline, hover, opacity );
+            if( hasFocus ) outline = derivedColor( palette, ColorFocus, ColorHover, opacity );
+            else outline = derivedColor( palette, ColorSliderOutline, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -330,8 +315,7 @@ namespace Breeze
 
         } else if( mode == AnimationFocus ) {
 
-            const QColor focus( focusColor( palette ) );
-            outline = KColorUtils::mix( outline, focus, opacity );
+            outline = derivedColor( palette, ColorSliderOutline, ColorFocus, opacity );
 
         } else if( hasFocus ) {
 
@@ -347,16 +331,14 @@ namespace Breeze
     QColor Helper::scrollBarHandleColor( const QPalette& palette, bool mouseOver, bool hasFocus, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor color( alphaColor( palette.color( QPalette::WindowText ), 0.5 ) );
+        QColor color( derivedColor( palette, ColorScrollBarHandle ) );
 
         // hover takes precedence over focus
         if( mode == AnimationHover )
         {
 
-            const QColor hover( hoverColor( palette ) );
-            const QColor focus( focusColor( palette ) );
-            if( hasFocus ) color = KColorUtils::mix( focus, hover, opacity );
-            else color = KColorUtils::mix( color, hover, opacity );
+            if( hasFocus ) color = derivedColor( palette, ColorFocus, ColorHover, opacity );
+            else color = derivedColor( palette, ColorScrollBarHandle, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -364,8 +346,7 @@ namespace Breeze
 
         } else if( mode == AnimationFocus ) {
 
-            const QColor focus( focusColor( palette ) );
-            color = KColorUtils::mix( color, focus, opacity );
+            color = derivedColor( palette, ColorScrollBarHandle, ColorFocus, opacity );
 
         } else if( hasFocus ) {
 
@@ -381,14 +362,12 @@ namespace Breeze
     QColor Helper::checkBoxIndicatorColor( const QPalette& palette, bool mouseOver, bool active, qreal opacity, AnimationMode mode ) const
     {
 
-        QColor color( KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.6 ) );
+        QColor color( derivedColor( palette, ColorCheckBoxIndicator ) );
         if( mode == AnimationHover )
         {
 
-            const QColor focus( focusColor( palette ) );
-            const QColor hover( hoverColor( palette ) );
-            if( active ) color =  KColorUtils::mix( focus, hover, opacity );
-            else color = KColorUtils::mix( color, hover, opacity );
+            if( active ) color = derivedColor( palette, ColorFocus, ColorHover, opacity );
+            else color = derivedColor( palette, ColorCheckBoxIndicator, ColorHover, opacity );
 
         } else if( mouseOver ) {
 
@@ -406,7 +385,81 @@ namespace Breeze
 
     //______________________________________________________________________________
     QColor Helper::separatorColor( const QPalette& palette ) const
-    { return KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.25 ); }
+    { return derivedColor( palette, ColorFrameOutline ); }
+
+    //______________________________________________________________________________
+    Helper::PaletteColors* Helper::paletteColors( const QPalette& palette ) const
+    {
+
+        const PaletteColorKey key( palette.cacheKey(), palette.currentColorGroup() );
+        PaletteColors* colors( _paletteColorCache.object( key ) );
+        if( !colors )
+        {
+            colors = new PaletteColors;
+            _paletteColorCache.insert( key, colors );
+        }
+
+        return colors;
+
+    }
+
+    //______________________________________________________________________________
+    QColor Helper::derivedColor( const QPalette& palette, DerivedColor role ) const
+    {
+
+        QColor& color( paletteColors( palette )->colors[role] );
+        if( color.isValid() ) return color;
+
+        switch( role )
+        {
+            case ColorHover: color = _viewHoverBrush.brush( palette ).color(); break;
+            case ColorFocus: color = _viewFocusBrush.brush( palette ).color(); break;
+            case ColorNegativeText: color = _viewNegativeTextBrush.brush( palette ).color(); break;
+            case ColorFocusOutline: color = KColorUtils::mix( derivedColor( palette, ColorFocus ), palette.color( QPalette::WindowText ), 0.15 ); break;
+            case ColorHoverOutline: color = KColorUtils::mix( derivedColor( palette, ColorHover ), palette.color( QPalette::WindowText ), 0.15 ); break;
+            case ColorButtonFocusOutline: color = KColorUtils::mix( derivedColor( palette, ColorFocus ), palette.color( QPalette::ButtonText ), 0.15 ); break;
+            case ColorButtonHoverOutline: color = KColorUtils::mix( derivedColor( palette, ColorHover ), palette.color( QPalette::ButtonText ), 0.15 ); break;
+            case ColorFrameOutline: color = KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.25 ); break;
+            case ColorSidePanelOutline: color = palette.color( QPalette::Inactive, QPalette::Highlight ); break;
+            case ColorSidePanelFocus: color = palette.color( QPalette::Active, QPalette::Highlight ); break;
+            case ColorArrow: color = arrowColor( palette, QPalette::WindowText ); break;
+            case ColorButtonOutline: color = KColorUtils::mix( palette.color( QPalette::Button ), palette.color( QPalette::ButtonText ), 0.3 ); break;
+            case ColorButton: color = palette.color( QPalette::Button ); break;
+            case ColorButtonSunken: color = KColorUtils::mix( palette.color( QPalette::Button ), palette.color( QPalette::ButtonText ), 0.2 ); break;
+            case ColorToolButtonSunken: color = alphaColor( palette.color( QPalette::WindowText ), 0.2 ); break;
+            case ColorSliderOutline: color = KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.4 ); break;
+            case ColorScrollBarHandle: color = alphaColor( palette.color( QPalette::WindowText ), 0.5 ); break;
+            case ColorCheckBoxIndicator: color = KColorUtils::mix( palette.color( QPalette::Window ), palette.color( QPalette::WindowText ), 0.6 ); break;
+            default: break;
+        }
+
+        return color;
+
+    }
+
+    //______________________________________________________________________________
+    QColor Helper::derivedColor( const QPalette& palette, DerivedColor first, DerivedColor second, qreal opacity ) const
+    {
+
+        // animation opacities are digitized to the configured number of steps, which are used to index the ramp
+        const int steps( AnimationData::steps() );
+        const qreal position( opacity*steps );
+        const int index( qRound( position ) );
+        if( steps <= 0 || index < 0 || index > steps || qAbs( position - index ) > 0.01 )
+        { return KColorUtils::mix( derivedColor( palette, first ), derivedColor( palette, second ), opacity ); }
+
+        QVector<QColor>& ramp( paletteColors( palette )->ramps[ first*ColorCount + second ] );
+        if( ramp.size() != steps + 1 )
+        {
+            ramp.clear();
+            ramp.resize( steps + 1 );
+        }
+
+        QColor& color( ramp[index] );
+        if( !color.isValid() ) color = KColorUtils::mix( derivedColor( palette, first ), derivedColor( palette, second ), qreal( index )/steps );
+        return color;
+
+    }
 
     //______________________________________________________________________________
     QPalette Helper::disabledPalette( const QPalette& source, qreal ratio ) const
@@ -498,6 +551,33 @@ namespace Breeze
         const QColor& color, const QColor& outline ) const
     {
 
+        // corners and a one pixel wide center, large enough to contain the rounded corners
+        const int tileSize( Metrics::Frame_FrameRadius + 2 );
+        const QSize sourceSize( 2*tileSize + 1, 2*tileSize + 1 );
+        if( rect.width() <= sourceSize.width() || rect.height() <= sourceSize.height() || !canUseRenderCache( painter ) )
+        { return renderFrameDirect( painter, rect, color, outline ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedFrame, sourceSize, color, outline ) );
+        if( const TileSet* tileSet = _tileSetCache.object( key ) )
+        { return tileSet->render( rect, painter, TileSet::Full ); }
+
+        QPixmap pixmap( renderCachePixmap( sourceSize ) );
+        QPainter local( &pixmap );
+        renderFrameDirect( &local, QRect( QPoint( 0, 0 ), sourceSize ), color, outline );
+        local.end();
+
+        const TileSet tileSet( pixmap, tileSize, tileSize, 1, 1 );
+        _tileSetCache.insert( key, new TileSet( tileSet ), renderCacheCost( pixmap ) );
+        tileSet.render( rect, painter, TileSet::Full );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderFrameDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color, const QColor& outline ) const
+    {
+
         painter->setRenderHint( QPainter::Antialiasing );
 
         QRectF frameRect( rect.adjusted( 1, 1, -1, -1 ) );
@@ -632,6 +712,37 @@ namespace Breeze
         bool hasFocus, bool sunken ) const
     {
 
+        /*
+        gradients depend on the frame height, so buttons are only tiled horizontally,
+        with full height left and right chunks and a one pixel wide center
+        */
+        const int tileSize( Metrics::Frame_FrameRadius + 3 );
+        const QSize sourceSize( 2*tileSize + 1, rect.height() );
+        if( rect.width() <= sourceSize.width() || rect.height() <= 0 || !canUseRenderCache( painter ) )
+        { return renderButtonFrameDirect( painter, rect, color, outline, shadow, hasFocus, sunken ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedButtonFrame, sourceSize, color, outline, shadow, (hasFocus ? 1:0)|(sunken ? 2:0) ) );
+        if( const TileSet* tileSet = _tileSetCache.object( key ) )
+        { return tileSet->render( rect, painter, TileSet::Horizontal ); }
+
+        QPixmap pixmap( renderCachePixmap( sourceSize ) );
+        QPainter local( &pixmap );
+        renderButtonFrameDirect( &local, QRect( QPoint( 0, 0 ), sourceSize ), color, outline, shadow, hasFocus, sunken );
+        local.end();
+
+        const TileSet tileSet( pixmap, tileSize, 0, 1, sourceSize.height() );
+        _tileSetCache.insert( key, new TileSet( tileSet ), renderCacheCost( pixmap ) );
+        tileSet.render( rect, painter, TileSet::Horizontal );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderButtonFrameDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color, const QColor& outline, const QColor& shadow,
+        bool hasFocus, bool sunken ) const
+    {
+
         // setup painter
         painter->setRenderHint( QPainter::Antialiasing, true );
 
@@ -769,6 +880,33 @@ namespace Breeze
         const QColor& color, const QColor& outline, Corners corners ) const
     {
 
+        // corners and a one pixel wide center, large enough to contain the rounded corners
+        const int tileSize( Metrics::Frame_FrameRadius + 2 );
+        const QSize sourceSize( 2*tileSize + 1, 2*tileSize + 1 );
+        if( rect.width() <= sourceSize.width() || rect.height() <= sourceSize.height() || !canUseRenderCache( painter ) )
+        { return renderTabWidgetFrameDirect( painter, rect, color, outline, corners ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedTabWidgetFrame, sourceSize, color, outline, QColor(), corners ) );
+        if( const TileSet* tileSet = _tileSetCache.object( key ) )
+        { return tileSet->render( rect, painter, TileSet::Full ); }
+
+        QPixmap pixmap( renderCachePixmap( sourceSize ) );
+        QPainter local( &pixmap );
+        renderTabWidgetFrameDirect( &local, QRect( QPoint( 0, 0 ), sourceSize ), color, outline, corners );
+        local.end();
+
+        const TileSet tileSet( pixmap, tileSize, tileSize, 1, 1 );
+        _tileSetCache.insert( key, new TileSet( tileSet ), renderCacheCost( pixmap ) );
+        tileSet.render( rect, painter, TileSet::Full );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderTabWidgetFrameDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color, const QColor& outline, Corners corners ) const
+    {
+
         painter->setRenderHint( QPainter::Antialiasing );
 
         QRectF frameRect( rect.adjusted( 1, 1, -1, -1 ) );
@@ -801,10 +939,9 @@ namespace Breeze
         const QColor& color ) const
     {
 
-        painter->setRenderHint( QPainter::Antialiasing );
-        painter->setPen( Qt::NoPen );
-        painter->setBrush( color );
-        painter->drawRect( rect );
+        // selection is a pixel aligned rect. Fill it directly rather than going through
+        // the antialiased path rasterizer, and leave painter state untouched
+        painter->fillRect( rect, color );
 
     }
 
@@ -863,6 +1000,30 @@ namespace Breeze
         bool sunken, CheckBoxState state, qreal animation ) const
     {
 
+        if( !rect.isValid() || !canUseRenderCache( painter ) )
+        { return renderCheckBoxDirect( painter, rect, color, shadow, sunken, state, animation ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedCheckBox, rect.size(), color, shadow, QColor(), (sunken ? 1:0)|(state << 1), animation ) );
+        if( const QPixmap* cached = _pixmapCache.object( key ) )
+        { return painter->drawPixmap( rect.topLeft(), *cached ); }
+
+        QPixmap pixmap( renderCachePixmap( rect.size() ) );
+        QPainter local( &pixmap );
+        renderCheckBoxDirect( &local, QRect( QPoint( 0, 0 ), rect.size() ), color, shadow, sunken, state, animation );
+        local.end();
+
+        _pixmapCache.insert( key, new QPixmap( pixmap ), renderCacheCost( pixmap ) );
+        painter->drawPixmap( rect.topLeft(), pixmap );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderCheckBoxDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color, const QColor& shadow,
+        bool sunken, CheckBoxState state, qreal animation ) const
+    {
+
         // setup painter
         painter->setRenderHint( QPainter::Antialiasing, true );
 
@@ -971,6 +1132,30 @@ namespace Breeze
         bool sunken, RadioButtonState state, qreal animation ) const
     {
 
+        if( !rect.isValid() || !canUseRenderCache( painter ) )
+        { return renderRadioButtonDirect( painter, rect, color, shadow, sunken, state, animation ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedRadioButton, rect.size(), color, shadow, QColor(), (sunken ? 1:0)|(state << 1), animation ) );
+        if( const QPixmap* cached = _pixmapCache.object( key ) )
+        { return painter->drawPixmap( rect.topLeft(), *cached ); }
+
+        QPixmap pixmap( renderCachePixmap( rect.size() ) );
+        QPainter local( &pixmap );
+        renderRadioButtonDirect( &local, QRect( QPoint( 0, 0 ), rect.size() ), color, shadow, sunken, state, animation );
+        local.end();
+
+        _pixmapCache.insert( key, new QPixmap( pixmap ), renderCacheCost( pixmap ) );
+        painter->drawPixmap( rect.topLeft(), pixmap );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderRadioButtonDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color, const QColor& shadow,
+        bool sunken, RadioButtonState state, qreal animation ) const
+    {
+
         // setup painter
         painter->setRenderHint( QPainter::Antialiasing, true );
 
@@ -1126,6 +1311,32 @@ namespace Breeze
         bool sunken ) const
     {
 
+        if( !rect.isValid() || !canUseRenderCache( painter ) )
+        { return renderSliderHandleDirect( painter, rect, color, outline, shadow, sunken ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedSliderHandle, rect.size(), color, outline, shadow, sunken ? 1:0 ) );
+        if( const QPixmap* cached = _pixmapCache.object( key ) )
+        { return painter->drawPixmap( rect.topLeft(), *cached ); }
+
+        QPixmap pixmap( renderCachePixmap( rect.size() ) );
+        QPainter local( &pixmap );
+        renderSliderHandleDirect( &local, QRect( QPoint( 0, 0 ), rect.size() ), color, outline, shadow, sunken );
+        local.end();
+
+        _pixmapCache.insert( key, new QPixmap( pixmap ), renderCacheCost( pixmap ) );
+        painter->drawPixmap( rect.topLeft(), pixmap );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderSliderHandleDirect(
+        QPainter* painter, const QRect& rect,
+        const QColor& color,
+        const QColor& outline,
+        const QColor& shadow,
+        bool sunken ) const
+    {
+
         // setup painter
         painter->setRenderHint( QPainter::Antialiasing, true );
 
@@ -1202,41 +1413,45 @@ namespace Breeze
         const QRectF baseRect( rect );
         const qreal radius( 0.5*Metrics::ProgressBar_Thickness );
 
-        // setup brush
-        QPixmap pixmap( horizontal ? 2*Metrics::ProgressBar_BusyIndicatorSize : 1, horizontal ? 1:2*Metrics::ProgressBar_BusyIndicatorSize );
-        pixmap.fill( second );
-        if( horizontal )
-        {
+        // stripe offset
+        const int period( 2*Metrics::ProgressBar_BusyIndicatorSize );
+        progress %= period;
+        if( reverse || !horizontal ) progress = period - progress - 1;
 
-            QPainter painter( &pixmap );
-            painter.setBrush( first );
-            painter.setPen( Qt::NoPen );
+        // setup brush. The texture does not depend on progress, which only translates it
+        QBrush brush( progressBarBusyTexture( first, second, horizontal ) );
+        brush.setTransform( horizontal ? QTransform::fromTranslate( progress, 0 ) : QTransform::fromTranslate( 0, progress ) );
 
-            progress %= 2*Metrics::ProgressBar_BusyIndicatorSize;
-            if( reverse ) progress = 2*Metrics::ProgressBar_BusyIndicatorSize - progress - 1;
-            painter.drawRect( QRect( 0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1 ).translated( progress, 0 ) );
+        painter->setPen( Qt::NoPen );
+        painter->setBrush( brush );
+        painter->drawRoundedRect( baseRect, radius, radius );
 
-            if( progress > Metrics::ProgressBar_BusyIndicatorSize )
-            { painter.drawRect( QRect( 0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1 ).translated( progress - 2*Metrics::ProgressBar_BusyIndicatorSize, 0 ) ); }
+    }
 
-        } else {
+    //______________________________________________________________________________
+    QPixmap Helper::progressBarBusyTexture( const QColor& first, const QColor& second, bool horizontal ) const
+    {
 
-            QPainter painter( &pixmap );
-            painter.setBrush( first );
-            painter.setPen( Qt::NoPen );
+        const int period( 2*Metrics::ProgressBar_BusyIndicatorSize );
+        const QSize size( horizontal ? period : 1, horizontal ? 1 : period );
 
-            progress %= 2*Metrics::ProgressBar_BusyIndicatorSize;
-            progress = 2*Metrics::ProgressBar_BusyIndicatorSize - progress - 1;
-            painter.drawRect( QRect( 0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize ).translated( 0, progress ) );
+        const RenderCacheKey key( renderCacheKey( CachedProgressBarBusyTexture, size, first, second, QColor(), horizontal ? 1:0 ) );
+        if( const QPixmap* cached = _pixmapCache.object( key ) )
+        { return *cached; }
 
-            if( progress > Metrics::ProgressBar_BusyIndicatorSize )
-            { painter.drawRect( QRect( 0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize ).translated( 0, progress - 2*Metrics::ProgressBar_BusyIndicatorSize ) ); }
+        // first color covers the first half of the period
+        QPixmap pixmap( size );
+        pixmap.fill( second );
 
-        }
+        QPainter painter( &pixmap );
+        painter.setBrush( first );
+        painter.setPen( Qt::NoPen );
+        if( horizontal ) painter.drawRect( QRect( 0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1 ) );
+        else painter.drawRect( QRect( 0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize ) );
+        painter.end();
 
-        painter->setPen( Qt::NoPen );
-        painter->setBrush( pixmap );
-        painter->drawRoundedRect( baseRect, radius, radius );
+        _pixmapCache.insert( key, new QPixmap( pixmap ), renderCacheCost( pixmap ) );
+        return pixmap;
 
     }
 
@@ -1265,6 +1480,31 @@ namespace Breeze
 
     //______________________________________________________________________________
     void Helper::renderTabBarTab( QPainter* painter, const QRect& rect, const QColor& color, const QColor& outline, Corners corners ) const
+    {
+
+        // corners and a one pixel wide center, large enough to contain the rounded corners
+        const int tileSize( Metrics::Frame_FrameRadius + 2 );
+        const QSize sourceSize( 2*tileSize + 1, 2*tileSize + 1 );
+        if( rect.width() <= sourceSize.width() || rect.height() <= sourceSize.height() || !canUseRenderCache( painter ) )
+        { return renderTabBarTabDirect( painter, rect, color, outline, corners ); }
+
+        const RenderCacheKey key( renderCacheKey( CachedTabBarTab, sourceSize, color, outline, QColor(), corners ) );
+        if( const TileSet* tileSet = _tileSetCache.object( key ) )
+        { return tileSet->render( rect, painter, TileSet::Full ); }
+
+        QPixmap pixmap( renderCachePixmap( sourceSize ) );
+        QPainter local( &pixmap );
+        renderTabBarTabDirect( &local, QRect( QPoint( 0, 0 ), sourceSize ), color, outline, corners );
+        local.end();
+
+        const TileSet tileSet( pixmap, tileSize, tileSize, 1, 1 );
+        _tileSetCache.insert( key, new TileSet( tileSet ), renderCacheCost( pixmap ) );
+        tileSet.render( rect, painter, TileSet::Full );
+
+    }
+
+    //______________________________________________________________________________
+    void Helper::renderTabBarTabDirect( QPainter* painter, const QRect& rect, const QColor& color, const QColor& outline, Corners corners ) const
     {
 
         // setup painter
@@ -1436,6 +1676,21 @@ namespace Breeze
 
     //______________________________________________________________________________
     QPainterPath Helper::roundedPath( const QRectF& rect, Corners corners, qreal radius ) const
+    {
+
+        // paths are stored at the origin and translated to the requested rect
+        const PathCacheKey key = { rect.width(), rect.height(), quint32( corners ), radius };
+        if( const QPainterPath* cached = _pathCache.object( key ) )
+        { return cached->translated( rect.topLeft() ); }
+
+        const QPainterPath path( createRoundedPath( QRectF( QPointF( 0, 0 ), rect.size() ), corners, radius ) );
+        _pathCache.insert( key, new QPainterPath( path ) );
+        return path.translated( rect.topLeft() );
+
+    }
+
+    //______________________________________________________________________________
+    QPainterPath Helper::createRoundedPath( const QRectF& rect, Corners corners, qreal radius ) const
     {
 
         QPainterPath path;
@@ -1500,8 +1755,81 @@ namespace Breeze
 
     }
 
+    //______________________________________________________________________________
+    Helper::RenderCacheKey Helper::renderCacheKey(
+        CachedPrimitive primitive, const QSize& size,
+        const QColor& first, const QColor& second, const QColor& third,
+        quint32 flags, qreal animation ) const
+    {
+        RenderCacheKey key;
+        key.primitive = primitive;
+        key.size = size;
+        key.colors[0] = first.rgba();
+        key.colors[1] = second.rgba();
+        key.colors[2] = third.rgba();
+        key.validColors = (first.isValid() ? 1:0)|(second.isValid() ? 2:0)|(third.isValid() ? 4:0);
+        key.flags = flags;
+        key.step = animation >= 0 ? qRound( animation*1000 ) : -1;
+
+        #if QT_VERSION >= 0x050300
+        key.dpiRatio = qRound( qApp->devicePixelRatio() );
+        #else
+        key.dpiRatio = 1;
+        #endif
+
+        return key;
+    }
+
+    //______________________________________________________________________________
+    bool Helper::canUseRenderCache( const QPainter* painter ) const
+    {
+
+        // keep vector output for printers and pictures
+        const int type( painter->device()->devType() );
+        if( type != QInternal::Widget && type != QInternal::Pixmap && type != QInternal::Image ) return false;
+
+        // cached pixmaps are only pixel exact when translated by integer amounts
+        const QTransform transform( painter->combinedTransform() );
+        if( transform.type() > QTransform::TxTranslate ) return false;
+        if( qreal( qRound( transform.dx() ) ) != transform.dx() || qreal( qRound( transform.dy() ) ) != transform.dy() ) return false;
+
+        // fractional scaling would show seams between tiles
+        #if QT_VERSION >= 0x050300
+        const qreal dpiRatio( qApp->devicePixelRatio() );
+        if( qreal( qRound( dpiRatio ) ) != dpiRatio ) return false;
+        #endif
+
+        return true;
+
+    }
+
+    //______________________________________________________________________________
+    QPixmap Helper::renderCachePixmap( const QSize& size ) const
+    {
+        QPixmap pixmap( highDpiPixmap( size ) );
+        pixmap.fill( Qt::transparent );
+        return pixmap;
+    }
+
+    //______________________________________________________________________________
+    int Helper::renderCacheCost( const QPixmap& pixmap ) const
+    { return qMax( 1, pixmap.width()*pixmap.height()*pixmap.depth()/( 8*1024 ) ); }
+
     //________________________________________________________________________________________________________
     bool Helper::compositingActive() const
+    {
+
+        #if !BREEZE_USE_KDE4
+        // state is tracked from KWindowSystem notifications, see init()
+        if( _compositingConnection ) return _compositingActive;
+        #endif
+
+        return queryCompositingActive();
+
+    }
+
+    //________________________________________________________________________________________________________
+    bool Helper::queryCompositingActive() const
     {
 
         #if BREEZE_HAVE_X11
@@ -1587,6 +1915,17 @@ namespace Breeze
     //____________________________________________________________________
     void Helper::init()
     {
+
+        // palette color cache budget, in number of palette and color group combinations
+        _paletteColorCache.setMaxCost( 64 );
+
+        // path cache budget, in number of paths
+        _pathCache.setMaxCost( 256 );
+
+        // render cache budget, in kB
+        _pixmapCache.setMaxCost( 2048 );
+        _tileSetCache.setMaxCost( 2048 );
+
         #if BREEZE_HAVE_X11
 
         if( isX11() )
@@ -1598,6 +1937,17 @@ namespace Breeze
 
         #endif
 
+        #if !BREEZE_USE_KDE4
+        /*
+        track compositing state changes rather than blocking on a selection owner request each time it is needed.
+        Connecting first makes KWindowSystem watch the compositing manager selection, so that no change is missed
+        */
+        _compositingConnection = QObject::connect( KWindowSystem::self(), &KWindowSystem::compositingChanged,
+            [this]( bool active ) { _compositingActive = active; } );
+        #endif
+
+        _compositingActive = queryCompositingActive();
+
     }
 
 }
@@ -23,6 +23,7 @@
 
 #include "breeze.h"
 #include "breezeanimationdata.h"
+#include "breezetileset.h"
 #include "config-breeze.h"
 
 #include <KColorScheme>
@@ -32,6 +33,7 @@
 #include <KComponentData>
 #endif
 
+#include <QCache>
 #include <QPainterPath>
 #include <QWidget>
 
@@ -58,8 +60,7 @@ namespace Breeze
         #endif
 
         //* destructor
-        virtual ~Helper()
-        {}
+        virtual ~Helper();
 
         //* load configuration
         virtual void loadConfig();
@@ -75,15 +76,15 @@ namespace Breeze
 
         //* mouse over color
         QColor hoverColor( const QPalette& palette ) const
-        { return _viewHoverBrush.brush( palette ).color(); }
+        { return derivedColor( palette, ColorHover ); }
 
         //* focus color
         QColor focusColor( const QPalette& palette ) const
-        { return _viewFocusBrush.brush( palette ).color(); }
+        { return derivedColor( palette, ColorFocus ); }
 
         //* negative text color (used for close button)
         QColor negativeText( const QPalette& palette ) const
-        { return _viewNegativeTextBrush.brush( palette ).color(); }
+        { return derivedColor( palette, ColorNegativeText ); }
 
         //* shadow
         QColor shadowColor( const QPalette& palette ) const
@@ -265,6 +266,9 @@ namespace Breeze
         //* returns true if compositing is active
         bool compositingActive() const;
 
+        //* query compositing state from the window system, bypassing the cached value
+        bool queryCompositingActive() const;
+
         //* returns true if a given widget supports alpha channel
         bool hasAlphaChannel( const QWidget* ) const;
 
@@ -321,6 +325,153 @@ namespace Breeze
 
         private:
 
+        //* create rounded path, uncached
+        QPainterPath createRoundedPath( const QRectF&, Corners, qreal ) const;
+
+        //*@name palette derived colors
+        //@{
+
+        //* colors derived from a palette's current color group
+        enum DerivedColor
+        {
+            ColorHover,
+            ColorFocus,
+            ColorNegativeText,
+            ColorFocusOutline,
+            ColorHoverOutline,
+            ColorButtonFocusOutline,
+            ColorButtonHoverOutline,
+            ColorFrameOutline,
+            ColorSidePanelOutline,
+            ColorSidePanelFocus,
+            ColorArrow,
+            ColorButtonOutline,
+            ColorButton,
+            ColorButtonSunken,
+            ColorToolButtonSunken,
+            ColorSliderOutline,
+            ColorScrollBarHandle,
+            ColorCheckBoxIndicator,
+            ColorCount
+        };
+
+        //* derived colors, computed on demand, and animation ramps between pairs of them
+        struct PaletteColors
+        {
+            QColor colors[ColorCount];
+            QHash<int, QVector<QColor>> ramps;
+        };
+
+        //* palette cache key and color group
+        using PaletteColorKey = QPair<qint64, int>;
+
+        //* derived colors for a given palette and its current color group
+        PaletteColors* paletteColors( const QPalette& ) const;
+
+        //* derived color
+        QColor derivedColor( const QPalette&, DerivedColor ) const;
+
+        //* mix between two derived colors, for animations
+        QColor derivedColor( const QPalette&, DerivedColor, DerivedColor, qreal opacity ) const;
+
+        //@}
+
+        //*@name render cache
+        //@{
+
+        //* primitives stored in render cache
+        enum CachedPrimitive
+        {
+            CachedFrame,
+            CachedButtonFrame,
+            CachedCheckBox,
+            CachedRadioButton,
+            CachedSliderHandle,
+            CachedTabBarTab,
+            CachedTabWidgetFrame,
+            CachedProgressBarBusyTexture
+        };
+
+        //* render cache key
+        struct RenderCacheKey
+        {
+            quint32 primitive;
+            QSize size;
+            QRgb colors[3];
+            quint32 validColors;
+            quint32 flags;
+            qint32 step;
+            qint32 dpiRatio;
+
+            bool operator == ( const RenderCacheKey& other ) const
+            {
+                return primitive == other.primitive &&
+                    size == other.size &&
+                    colors[0] == other.colors[0] &&
+                    colors[1] == other.colors[1] &&
+                    colors[2] == other.colors[2] &&
+                    validColors == other.validColors &&
+                    flags == other.flags &&
+                    step == other.step &&
+                    dpiRatio == other.dpiRatio;
+            }
+
+            friend uint qHash( const RenderCacheKey& key )
+            {
+                uint hash( qHash( key.primitive ) ^ ( qHash( key.size.width() ) << 8 ) ^ ( qHash( key.size.height() ) << 16 ) );
+                for( int i = 0; i < 3; ++i ) hash = hash*31 + qHash( key.colors[i] );
+                return hash ^ qHash( ( key.validColors << 24 ) | ( key.flags << 8 ) | key.dpiRatio ) ^ qHash( key.step );
+            }
+
+        };
+
+        //* rounded path cache key
+        struct PathCacheKey
+        {
+            qreal width;
+            qreal height;
+            quint32 corners;
+            qreal radius;
+
+            bool operator == ( const PathCacheKey& other ) const
+            {
+                return width == other.width &&
+                    height == other.height &&
+                    corners == other.corners &&
+                    radius == other.radius;
+            }
+
+            friend uint qHash( const PathCacheKey& key )
+            { return qHash( qRound( key.width*16 ) ) ^ ( qHash( qRound( key.height*16 ) ) << 12 ) ^ ( key.corners << 24 ) ^ qHash( qRound( key.radius*16 ) ); }
+
+        };
+
+        //* create render cache key
+        RenderCacheKey renderCacheKey( CachedPrimitive, const QSize&, const QColor&, const QColor& = QColor(), const QColor& = QColor(), quint32 flags = 0, qreal animation = AnimationData::OpacityInvalid ) const;
+
+        //* true if cached pixmaps can be painted pixel-exact on a given painter
+        bool canUseRenderCache( const QPainter* ) const;
+
+        //* transparent pixmap used to fill render cache
+        QPixmap renderCachePixmap( const QSize& ) const;
+
+        //* render cache cost (kB) for a given pixmap
+        int renderCacheCost( const QPixmap& ) const;
+
+        //* busy progress bar stripe texture, one stripe period long
+        QPixmap progressBarBusyTexture( const QColor& first, const QColor& second, bool horizontal ) const;
+
+        //* uncached rendering
+        void renderFrameDirect( QPainter*, const QRect&, const QColor& color, const QColor& outline ) const;
+        void renderButtonFrameDirect( QPainter*, const QRect&, const QColor& color, const QColor& outline, const QColor& shadow, bool focus, bool sunken ) const;
+        void renderCheckBoxDirect( QPainter*, const QRect&, const QColor& color, const QColor& shadow, bool sunken, CheckBoxState state, qreal animation ) const;
+        void renderRadioButtonDirect( QPainter*, const QRect&, const QColor& color, const QColor& shadow, bool sunken, RadioButtonState state, qreal animation ) const;
+        void renderSliderHandleDirect( QPainter*, const QRect&, const QColor&, const QColor& outline, const QColor& shadow, bool sunken ) const;
+        void renderTabBarTabDirect( QPainter*, const QRect&, const QColor& color, const QColor& outline, Corners ) const;
+        void renderTabWidgetFrameDirect( QPainter*, const QRect&, const QColor& color, const QColor& outline, Corners ) const;
+
+        //@}
+
         #if BREEZE_USE_KDE4
         //* component data
         KComponentData _componentData;
@@ -344,6 +495,23 @@ namespace Breeze
         QColor _inactiveTitleBarTextColor;
         //@}
 
+        //* palette derived colors
+        mutable QCache<PaletteColorKey, PaletteColors> _paletteColorCache;
+
+        //*@name render cache
+        //@{
+
+        //* rounded paths, at origin
+        mutable QCache<PathCacheKey, QPainterPath> _pathCache;
+
+        //* fixed size primitives
+        mutable QCache<RenderCacheKey, QPixmap> _pixmapCache;
+
+        //* resizable primitives, stored as tilesets
+        mutable QCache<RenderCacheKey, TileSet> _tileSetCache;
+
+        //@}
+
         #if BREEZE_HAVE_X11
 
         //* atom used for compositing manager
@@ -351,6 +519,14 @@ namespace Breeze
 
         #endif
 
+        //* cached compositing state
+        bool _compositingActive = false;
+
+        #if !BREEZE_USE_KDE4
+        //* connection to KWindowSystem compositing state notifications
+        QMetaObject::Connection _compositingConnection;
+        #endif
+
     };
 
 }
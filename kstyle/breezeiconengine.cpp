@@ -0,0 +1,89 @@
+/*************************************************************************
+ * Copyright (C) 2026 by agent <agent@local>                             *
+ *                                                                       *
+ * This program is free software; you can redistribute it and/or modify  *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation; either version 2 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * This program is distributed in the hope that it will be useful,       *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have received a copy of the GNU General Public License     *
+ * along with this program; if not, write to the                         *
+ * Free Software Foundation, Inc.,                                       *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA .        *
+ *************************************************************************/
+
+#include "breezeiconengine.h"
+
+#include "breezestyle.h"
+
+#include <QPainter>
+
+namespace Breeze
+{
+
+    //____________________________________________________________________
+    IconEngine::IconEngine( const Style* style, QStyle::StandardPixmap standardPixmap, const QPalette& palette ):
+        _style( style ),
+        _standardPixmap( standardPixmap ),
+        _palette( palette )
+    {}
+
+    //____________________________________________________________________
+    ParentIconEngineClass* IconEngine::clone() const
+    { return new IconEngine( *this ); }
+
+    //____________________________________________________________________
+    void IconEngine::paint( QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state )
+    {
+
+        #if QT_VERSION >= 0x050600
+        const qreal dpiRatio( painter->device()->devicePixelRatioF() );
+        #elif QT_VERSION >= 0x050300
+        const qreal dpiRatio( painter->device()->devicePixelRatio() );
+        #else
+        const qreal dpiRatio( 1 );
+        #endif
+
+        painter->drawPixmap( rect.topLeft(), pixmap( rect.size()*dpiRatio, mode, state, dpiRatio ) );
+
+    }
+
+    //____________________________________________________________________
+    QPixmap IconEngine::pixmap( const QSize& size, QIcon::Mode mode, QIcon::State state, qreal dpiRatio )
+    {
+
+        // lookup cache
+        const quint64 key(
+            quint64( size.width() & 0xffff ) |
+            ( quint64( size.height() & 0xffff ) << 16 ) |
+            ( quint64( mode ) << 32 ) |
+            ( quint64( state ) << 36 ) |
+            ( quint64( qRound( dpiRatio*100 ) ) << 40 ) );
+
+        const PixmapCache::const_iterator iter( _pixmaps.constFind( key ) );
+        if( iter != _pixmaps.constEnd() ) return iter.value();
+
+        // render, at device size
+        QPixmap pixmap( size );
+        pixmap.fill( Qt::transparent );
+        if( _style && !size.isEmpty() )
+        {
+            QPainter painter( &pixmap );
+            _style.data()->renderStandardIcon( &painter, pixmap.rect(), _standardPixmap, _palette, mode, state );
+        }
+
+        #if QT_VERSION >= 0x050300
+        pixmap.setDevicePixelRatio( dpiRatio );
+        #endif
+
+        _pixmaps.insert( key, pixmap );
+        return pixmap;
+
+    }
+
+}
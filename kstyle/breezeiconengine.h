@@ -0,0 +1,89 @@
+#ifndef breezeiconengine_h
+#define breezeiconengine_h
+
+/*************************************************************************
+ * Copyright (C) 2026 by agent <agent@local>                             *
+ *                                                                       *
+ * This program is free software; you can redistribute it and/or modify  *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation; either version 2 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * This program is distributed in the hope that it will be useful,       *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have received a copy of the GNU General Public License     *
+ * along with this program; if not, write to the                         *
+ * Free Software Foundation, Inc.,                                       *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA .        *
+ *************************************************************************/
+
+#include "breeze.h"
+
+#include <QHash>
+#include <QIconEngine>
+#include <QPalette>
+#include <QPixmap>
+#include <QStyle>
+
+namespace Breeze
+{
+
+    class Style;
+
+    //* convenience typedef for base class
+    #if QT_VERSION >= 0x050000
+    using ParentIconEngineClass = QIconEngine;
+    #else
+    using ParentIconEngineClass = QIconEngineV2;
+    #endif
+
+    //* icon engine for style standard icons
+    /** pixmaps are only rendered for the mode, state, size and device pixel ratio combinations actually requested */
+    class IconEngine: public ParentIconEngineClass
+    {
+
+        public:
+
+        //* constructor
+        explicit IconEngine( const Style*, QStyle::StandardPixmap, const QPalette& );
+
+        //* destructor
+        virtual ~IconEngine()
+        {}
+
+        //* paint icon in rect, at the painter's device pixel ratio
+        void paint( QPainter*, const QRect&, QIcon::Mode, QIcon::State ) override;
+
+        //* pixmap of given size, in device pixels
+        QPixmap pixmap( const QSize& size, QIcon::Mode mode, QIcon::State state ) override
+        { return pixmap( size, mode, state, 1 ); }
+
+        //* clone
+        ParentIconEngineClass* clone() const override;
+
+        private:
+
+        //* pixmap of given size, in device pixels, for a given device pixel ratio
+        QPixmap pixmap( const QSize&, QIcon::Mode, QIcon::State, qreal );
+
+        //* style
+        WeakPointer<const Style> _style;
+
+        //* standard pixmap
+        QStyle::StandardPixmap _standardPixmap;
+
+        //* palette
+        QPalette _palette;
+
+        //* rendered pixmaps
+        using PixmapCache = QHash<quint64, QPixmap>;
+        PixmapCache _pixmaps;
+
+    };
+
+}
+
+#endif
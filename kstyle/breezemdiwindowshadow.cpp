@@ -22,6 +22,7 @@
 #include "breeze.h"
 #include "breezeshadowhelper.h"
 #include "breezestyleconfigdata.h"
+#include "breezewidgetroles.h"
 
 #include <QMdiArea>
 #include <QMdiSubWindow>
@@ -78,12 +79,20 @@ namespace Breeze
         }
 
         // update geometry and mask
-        const QRegion mask = QRegion( geometry ) - hole.adjusted( 2, 2, -2, -2 );
-        if( mask.isEmpty() ) hide();
+        const QRect maskHole( hole.adjusted( 2, 2, -2, -2 ).translated( -geometry.topLeft() ) );
+        if( geometry.isEmpty() || maskHole.contains( QRect( QPoint( 0, 0 ), geometry.size() ) ) ) hide();
         else {
 
             setGeometry( geometry );
-            setMask( mask.translated( -geometry.topLeft() ) );
+
+            // only reset the mask when its local shape changes
+            if( geometry.size() != _maskSize || maskHole != _maskHole )
+            {
+                _maskSize = geometry.size();
+                _maskHole = maskHole;
+                setMask( QRegion( QRect( QPoint( 0, 0 ), _maskSize ) ) - _maskHole );
+            }
+
             show();
 
         }
@@ -98,14 +107,13 @@ namespace Breeze
     { stackUnder( _widget ); }
 
     //____________________________________________________________________
-    void MdiWindowShadow::paintEvent( QPaintEvent* event )
+    void MdiWindowShadow::paintEvent( QPaintEvent* )
     {
 
         if( !_shadowTiles.isValid() ) return;
 
+        // tiles are drawn at integer positions, and painting is already clipped to the exposed region
         QPainter painter( this );
-        painter.setRenderHints( QPainter::Antialiasing );
-        painter.setClipRegion( event->region() );
         _shadowTiles.render( _shadowTilesRect, &painter );
 
     }
@@ -120,9 +128,9 @@ namespace Breeze
     {
 
         // check widget type
-        auto subwindow( qobject_cast<QMdiSubWindow*>( widget ) );
-        if( !subwindow ) return false;
-        if( subwindow->widget() && subwindow->widget()->inherits( "KMainWindow" ) ) return false;
+        if( !( widgetRoles( widget ) & RoleMdiSubWindow ) ) return false;
+        auto subwindow( static_cast<QMdiSubWindow*>( widget ) );
+        if( widgetRoles( subwindow->widget() ) & RoleKMainWindow ) return false;
 
         // make sure widget is not already registered
         if( isRegistered( widget ) ) return false;
@@ -71,6 +71,13 @@ namespace Breeze
         //* tileset rect, used for painting
         QRect _shadowTilesRect;
 
+        //*@name last mask, in local coordinates
+        /** the mask only changes when the window is resized or clipped by the MDI area, not when it is moved */
+        //@{
+        QSize _maskSize;
+        QRect _maskHole;
+        //@}
+
         //* tileset used to draw shadow
         TileSet _shadowTiles;
 
@@ -24,14 +24,12 @@
 #include "breezehelper.h"
 #include "breezepropertynames.h"
 #include "breezestyleconfigdata.h"
+#include "breezewidgetroles.h"
 
-#include <QDockWidget>
 #include <QEvent>
 #include <QApplication>
-#include <QMenu>
 #include <QPainter>
 #include <QPixmap>
-#include <QToolBar>
 #include <QTextStream>
 
 #if BREEZE_HAVE_X11
@@ -361,19 +359,19 @@ namespace Breeze
 
     //_______________________________________________________
     bool ShadowHelper::isMenu( QWidget* widget ) const
-    { return qobject_cast<QMenu*>( widget ); }
+    { return widgetRoles( widget ) & RoleMenu; }
 
     //_______________________________________________________
     bool ShadowHelper::isToolTip( QWidget* widget ) const
-    { return widget->inherits( "QTipLabel" ) || (widget->windowFlags() & Qt::WindowType_Mask) == Qt::ToolTip; }
+    { return (widgetRoles( widget ) & RoleTipLabel) || (widget->windowFlags() & Qt::WindowType_Mask) == Qt::ToolTip; }
 
     //_______________________________________________________
     bool ShadowHelper::isDockWidget( QWidget* widget ) const
-    { return qobject_cast<QDockWidget*>( widget ); }
+    { return widgetRoles( widget ) & RoleDockWidget; }
 
     //_______________________________________________________
     bool ShadowHelper::isToolBar( QWidget* widget ) const
-    { return qobject_cast<QToolBar*>( widget ); }
+    { return widgetRoles( widget ) & RoleToolBar; }
 
     //_______________________________________________________
     bool ShadowHelper::acceptWidget( QWidget* widget ) const
@@ -387,10 +385,11 @@ namespace Breeze
         if( isMenu( widget ) ) return true;
 
         // combobox dropdown lists
-        if( widget->inherits( "QComboBoxPrivateContainer" ) ) return true;
+        const WidgetRoles roles( widgetRoles( widget ) );
+        if( roles & RoleComboBoxPrivateContainer ) return true;
 
         // tooltips
-        if( isToolTip( widget ) && !widget->inherits( "Plasma::ToolTip" ) )
+        if( isToolTip( widget ) && !( roles & RolePlasmaToolTip ) )
         { return true; }
 
         // detached widgets
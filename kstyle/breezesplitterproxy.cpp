@@ -21,6 +21,7 @@
 
 #include "breeze.h"
 #include "breezestyleconfigdata.h"
+#include "breezewidgetroles.h"
 
 #include <QCoreApplication>
 #include <QDebug>
@@ -70,7 +71,8 @@ namespace Breeze
     {
 
         // check widget type
-        if( qobject_cast<QMainWindow*>( widget ) )
+        const WidgetRoles roles( widgetRoles( widget ) );
+        if( roles & RoleMainWindow )
         {
 
             WidgetMap::iterator iter( _widgets.find( widget ) );
@@ -92,7 +94,7 @@ namespace Breeze
 
             return true;
 
-        } else if( qobject_cast<QSplitterHandle*>( widget ) ) {
+        } else if( roles & RoleSplitterHandle ) {
 
             QWidget* window( widget->window() );
             WidgetMap::iterator iter( _widgets.find( window ) );
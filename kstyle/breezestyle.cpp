@@ -22,6 +22,7 @@
 #include "breeze.h"
 #include "breezeanimations.h"
 #include "breezeframeshadow.h"
+#include "breezeiconengine.h"
 #include "breezemdiwindowshadow.h"
 #include "breezemnemonics.h"
 #include "breezepropertynames.h"
@@ -29,6 +30,7 @@
 #include "breezesplitterproxy.h"
 #include "breezestyleconfigdata.h"
 #include "breezewidgetexplorer.h"
+#include "breezewidgetroles.h"
 #include "breezewindowmanager.h"
 #include "breezeblurhelper.h"
 
@@ -220,24 +222,28 @@ namespace Breeze
         _shadowHelper->registerWidget( widget );
         _splitterFactory->registerWidget( widget );
 
+        // widget roles
+        const WidgetRoles roles( widgetRoles( widget ) );
+
         // enable mouse over effects for all necessary widgets
-        if(
-            qobject_cast<QAbstractItemView*>( widget )
-            || qobject_cast<QAbstractSpinBox*>( widget )
-            || qobject_cast<QCheckBox*>( widget )
-            || qobject_cast<QComboBox*>( widget )
-            || qobject_cast<QDial*>( widget )
-            || qobject_cast<QLineEdit*>( widget )
-            || qobject_cast<QPushButton*>( widget )
-            || qobject_cast<QRadioButton*>( widget )
-            || qobject_cast<QScrollBar*>( widget )
-            || qobject_cast<QSlider*>( widget )
-            || qobject_cast<QSplitterHandle*>( widget )
-            || qobject_cast<QTabBar*>( widget )
-            || qobject_cast<QTextEdit*>( widget )
-            || qobject_cast<QToolButton*>( widget )
-            || widget->inherits( "KTextEditor::View" )
-            )
+        static const WidgetRoles hoverRoles(
+            RoleAbstractItemView
+            | RoleAbstractSpinBox
+            | RoleCheckBox
+            | RoleComboBox
+            | RoleDial
+            | RoleLineEdit
+            | RolePushButton
+            | RoleRadioButton
+            | RoleScrollBar
+            | RoleSlider
+            | RoleSplitterHandle
+            | RoleTabBar
+            | RoleTextEdit
+            | RoleToolButton
+            | RoleKTextEditorView );
+
+        if( roles & hoverRoles )
         { widget->setAttribute( Qt::WA_Hover ); }
 
         // enforce translucency for drag and drop window
@@ -248,29 +254,33 @@ namespace Breeze
         }
 
         // scrollarea polishing is somewhat complex. It is moved to a dedicated method
-        polishScrollArea( qobject_cast<QAbstractScrollArea*>( widget ) );
+        if( roles & RoleAbstractScrollArea )
+        { polishScrollArea( static_cast<QAbstractScrollArea*>( widget ) ); }
+
+        // parent roles, for parent dependent checks
+        const WidgetRoles parentRoles( widgetRoles( widget->parent() ) );
 
-        if( auto itemView = qobject_cast<QAbstractItemView*>( widget ) )
+        if( roles & RoleAbstractItemView )
         {
 
             // enable mouse over effects in itemviews' viewport
-            itemView->viewport()->setAttribute( Qt::WA_Hover );
+            static_cast<QAbstractItemView*>( widget )->viewport()->setAttribute( Qt::WA_Hover );
 
-        } else if( auto groupBox = qobject_cast<QGroupBox*>( widget ) )  {
+        } else if( roles & RoleGroupBox )  {
 
             // checkable group boxes
-            if( groupBox->isCheckable() )
-            { groupBox->setAttribute( Qt::WA_Hover ); }
+            if( static_cast<QGroupBox*>( widget )->isCheckable() )
+            { widget->setAttribute( Qt::WA_Hover ); }
 
-        } else if( qobject_cast<QAbstractButton*>( widget ) && qobject_cast<QDockWidget*>( widget->parent() ) ) {
+        } else if( (roles & RoleAbstractButton) && (parentRoles & RoleDockWidget) ) {
 
             widget->setAttribute( Qt::WA_Hover );
 
-        } else if( qobject_cast<QAbstractButton*>( widget ) && qobject_cast<QToolBox*>( widget->parent() ) ) {
+        } else if( (roles & RoleAbstractButton) && (parentRoles & RoleToolBox) ) {
 
             widget->setAttribute( Qt::WA_Hover );
 
-        } else if( qobject_cast<QFrame*>( widget ) && widget->parent() && widget->parent()->inherits( "KTitleWidget" ) ) {
+        } else if( (roles & RoleFrame) && (parentRoles & RoleKTitleWidget) ) {
 
             widget->setAutoFillBackground( false );
             if( !StyleConfigData::titleWidgetDrawFrame() )
@@ -278,18 +288,19 @@ namespace Breeze
 
         }
 
-        if( qobject_cast<QScrollBar*>( widget ) )
+        if( roles & RoleScrollBar )
         {
 
             // remove opaque painting for scrollbars
             widget->setAttribute( Qt::WA_OpaquePaintEvent, false );
 
-        } else if( widget->inherits( "KTextEditor::View" ) ) {
+        } else if( roles & RoleKTextEditorView ) {
 
             addEventFilter( widget );
 
-        } else if( auto toolButton = qobject_cast<QToolButton*>( widget ) ) {
+        } else if( roles & RoleToolButton ) {
 
+            auto toolButton = static_cast<QToolButton*>( widget );
             if( toolButton->autoRaise() )
             {
                 // for flat toolbuttons, adjust foreground and background role accordingly
@@ -302,7 +313,7 @@ namespace Breeze
                 widget->parentWidget()->parentWidget()->inherits( "Gwenview::SideBarGroup" ) )
             { widget->setProperty( PropertyNames::toolButtonAlignment, Qt::AlignLeft ); }
 
-        } else if( qobject_cast<QDockWidget*>( widget ) ) {
+        } else if( roles & RoleDockWidget ) {
 
             // add event filter on dock widgets
             // and alter palette
@@ -310,23 +321,23 @@ namespace Breeze
             widget->setContentsMargins( Metrics::Frame_FrameWidth, Metrics::Frame_FrameWidth, Metrics::Frame_FrameWidth, Metrics::Frame_FrameWidth );
             addEventFilter( widget );
 
-        } else if( qobject_cast<QMdiSubWindow*>( widget ) ) {
+        } else if( roles & RoleMdiSubWindow ) {
 
             widget->setAutoFillBackground( false );
             addEventFilter( widget );
 
-        } else if( qobject_cast<QToolBox*>( widget ) ) {
+        } else if( roles & RoleToolBox ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setAutoFillBackground( false );
 
-        } else if( widget->parentWidget() && widget->parentWidget()->parentWidget() && qobject_cast<QToolBox*>( widget->parentWidget()->parentWidget()->parentWidget() ) ) {
+        } else if( widget->parentWidget() && widget->parentWidget()->parentWidget() && (widgetRoles( widget->parentWidget()->parentWidget()->parentWidget() ) & RoleToolBox) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setAutoFillBackground( false );
             widget->parentWidget()->setAutoFillBackground( false );
 
-        } else if( qobject_cast<QMenu*>( widget ) ) {
+        } else if( roles & RoleMenu ) {
 
             setTranslucentBackground( widget );
 
@@ -337,25 +348,25 @@ namespace Breeze
             #endif
 
         #if QT_VERSION >= 0x050000
-        } else if( qobject_cast<QCommandLinkButton*>( widget ) ) {
+        } else if( roles & RoleCommandLinkButton ) {
 
             addEventFilter( widget );
         #endif
-        } else if( auto comboBox = qobject_cast<QComboBox*>( widget ) ) {
+        } else if( roles & RoleComboBox ) {
 
             if( !hasParent( widget, "QWebView" ) )
             {
-                auto itemView( comboBox->view() );
+                auto itemView( static_cast<QComboBox*>( widget )->view() );
                 if( itemView && itemView->itemDelegate() && itemView->itemDelegate()->inherits( "QComboBoxDelegate" ) )
                 { itemView->setItemDelegate( new BreezePrivate::ComboBoxItemDelegate( itemView ) ); }
             }
 
-        } else if( widget->inherits( "QComboBoxPrivateContainer" ) ) {
+        } else if( roles & RoleComboBoxPrivateContainer ) {
 
             addEventFilter( widget );
             setTranslucentBackground( widget );
 
-        } else if( widget->inherits( "QTipLabel" ) ) {
+        } else if( roles & RoleTipLabel ) {
 
             setTranslucentBackground( widget );
 
@@ -469,6 +480,9 @@ namespace Breeze
             widget->inherits( "QComboBoxPrivateContainer" ) )
             { widget->removeEventFilter( this ); }
 
+        // remove cached scroll area data
+        _scrollAreaData.remove( widget );
+
         ParentStyleClass::unpolish( widget );
 
     }
@@ -836,51 +850,129 @@ namespace Breeze
     }
 
     //______________________________________________________________
-    void Style::drawPrimitive( PrimitiveElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget ) const
+    Style::PrimitiveDispatchEntry Style::primitiveDispatchEntry( PrimitiveElement element )
+    {
+
+        // note: PE_FrameFocusRect depends on configuration and is handled separately
+        static constexpr PrimitiveDispatchEntry entries[] =
+        {
+            { PE_PanelButtonCommand, &Style::drawPanelButtonCommandPrimitive, 0 },
+            { PE_PanelButtonTool, &Style::drawPanelButtonToolPrimitive, 0 },
+            { PE_PanelScrollAreaCorner, &Style::drawPanelScrollAreaCornerPrimitive, 0 },
+            { PE_PanelMenu, &Style::drawPanelMenuPrimitive, 0 },
+            { PE_PanelTipLabel, &Style::drawPanelTipLabelPrimitive, 0 },
+            { PE_PanelItemViewItem, &Style::drawPanelItemViewItemPrimitive, DispatchKeepsPainter },
+            { PE_IndicatorCheckBox, &Style::drawIndicatorCheckBoxPrimitive, 0 },
+            { PE_IndicatorRadioButton, &Style::drawIndicatorRadioButtonPrimitive, 0 },
+            { PE_IndicatorButtonDropDown, &Style::drawIndicatorButtonDropDownPrimitive, 0 },
+            { PE_IndicatorTabClose, &Style::drawIndicatorTabClosePrimitive, 0 },
+            { PE_IndicatorTabTear, &Style::drawIndicatorTabTearPrimitive, 0 },
+            { PE_IndicatorArrowUp, &Style::drawIndicatorArrowUpPrimitive, 0 },
+            { PE_IndicatorArrowDown, &Style::drawIndicatorArrowDownPrimitive, 0 },
+            { PE_IndicatorArrowLeft, &Style::drawIndicatorArrowLeftPrimitive, 0 },
+            { PE_IndicatorArrowRight, &Style::drawIndicatorArrowRightPrimitive, 0 },
+            { PE_IndicatorHeaderArrow, &Style::drawIndicatorHeaderArrowPrimitive, 0 },
+            { PE_IndicatorToolBarHandle, &Style::drawIndicatorToolBarHandlePrimitive, 0 },
+            { PE_IndicatorToolBarSeparator, &Style::drawIndicatorToolBarSeparatorPrimitive, 0 },
+            { PE_IndicatorBranch, &Style::drawIndicatorBranchPrimitive, 0 },
+            { PE_FrameStatusBar, &Style::emptyPrimitive, DispatchEmpty },
+            { PE_Frame, &Style::drawFramePrimitive, 0 },
+            { PE_FrameLineEdit, &Style::drawFrameLineEditPrimitive, 0 },
+            { PE_FrameMenu, &Style::drawFrameMenuPrimitive, 0 },
+            { PE_FrameGroupBox, &Style::drawFrameGroupBoxPrimitive, 0 },
+            { PE_FrameTabWidget, &Style::drawFrameTabWidgetPrimitive, 0 },
+            { PE_FrameTabBarBase, &Style::drawFrameTabBarBasePrimitive, 0 },
+            { PE_FrameWindow, &Style::drawFrameWindowPrimitive, 0 }
+        };
+
+        static const DispatchTable<PrimitiveElement, StylePrimitive, 128> table( entries );
+        return table.find( element );
+
+    }
+
+    //______________________________________________________________
+    Style::ControlDispatchEntry Style::controlDispatchEntry( ControlElement element )
+    {
+
+        static constexpr ControlDispatchEntry entries[] =
+        {
+            { CE_PushButtonBevel, &Style::drawPanelButtonCommandPrimitive, 0 },
+            { CE_PushButtonLabel, &Style::drawPushButtonLabelControl, 0 },
+            { CE_CheckBoxLabel, &Style::drawCheckBoxLabelControl, 0 },
+            { CE_RadioButtonLabel, &Style::drawCheckBoxLabelControl, 0 },
+            { CE_ToolButtonLabel, &Style::drawToolButtonLabelControl, 0 },
+            { CE_ComboBoxLabel, &Style::drawComboBoxLabelControl, 0 },
+            { CE_MenuBarEmptyArea, &Style::emptyControl, DispatchEmpty },
+            { CE_MenuBarItem, &Style::drawMenuBarItemControl, 0 },
+            { CE_MenuItem, &Style::drawMenuItemControl, 0 },
+            { CE_ToolBar, &Style::emptyControl, DispatchEmpty },
+            { CE_ProgressBar, &Style::drawProgressBarControl, 0 },
+            { CE_ProgressBarContents, &Style::drawProgressBarContentsControl, 0 },
+            { CE_ProgressBarGroove, &Style::drawProgressBarGrooveControl, 0 },
+            { CE_ProgressBarLabel, &Style::drawProgressBarLabelControl, 0 },
+            { CE_ScrollBarSlider, &Style::drawScrollBarSliderControl, 0 },
+            { CE_ScrollBarAddLine, &Style::drawScrollBarAddLineControl, 0 },
+            { CE_ScrollBarSubLine, &Style::drawScrollBarSubLineControl, 0 },
+            { CE_ScrollBarAddPage, &Style::emptyControl, DispatchEmpty },
+            { CE_ScrollBarSubPage, &Style::emptyControl, DispatchEmpty },
+            { CE_ShapedFrame, &Style::drawShapedFrameControl, 0 },
+            { CE_RubberBand, &Style::drawRubberBandControl, 0 },
+            { CE_SizeGrip, &Style::emptyControl, DispatchEmpty },
+            { CE_HeaderSection, &Style::drawHeaderSectionControl, 0 },
+            { CE_HeaderEmptyArea, &Style::drawHeaderEmptyAreaControl, 0 },
+            { CE_TabBarTabLabel, &Style::drawTabBarTabLabelControl, 0 },
+            { CE_TabBarTabShape, &Style::drawTabBarTabShapeControl, 0 },
+            { CE_ToolBoxTabLabel, &Style::drawToolBoxTabLabelControl, 0 },
+            { CE_ToolBoxTabShape, &Style::drawToolBoxTabShapeControl, 0 },
+            { CE_DockWidgetTitle, &Style::drawDockWidgetTitleControl, 0 }
+        };
+
+        static const DispatchTable<ControlElement, StyleControl, 128> table( entries );
+        return table.find( element );
+
+    }
+
+    //______________________________________________________________
+    Style::ComplexControlDispatchEntry Style::complexControlDispatchEntry( ComplexControl element )
     {
 
-        StylePrimitive fcn;
-        switch( element )
+        static constexpr ComplexControlDispatchEntry entries[] =
         {
+            { CC_GroupBox, &Style::drawGroupBoxComplexControl, 0 },
+            { CC_ToolButton, &Style::drawToolButtonComplexControl, 0 },
+            { CC_ComboBox, &Style::drawComboBoxComplexControl, 0 },
+            { CC_SpinBox, &Style::drawSpinBoxComplexControl, 0 },
+            { CC_Slider, &Style::drawSliderComplexControl, 0 },
+            { CC_Dial, &Style::drawDialComplexControl, 0 },
+            { CC_ScrollBar, &Style::drawScrollBarComplexControl, 0 },
+            { CC_TitleBar, &Style::drawTitleBarComplexControl, 0 }
+        };
 
-            case PE_PanelButtonCommand: fcn = &Style::drawPanelButtonCommandPrimitive; break;
-            case PE_PanelButtonTool: fcn = &Style::drawPanelButtonToolPrimitive; break;
-            case PE_PanelScrollAreaCorner: fcn = &Style::drawPanelScrollAreaCornerPrimitive; break;
-            case PE_PanelMenu: fcn = &Style::drawPanelMenuPrimitive; break;
-            case PE_PanelTipLabel: fcn = &Style::drawPanelTipLabelPrimitive; break;
-            case PE_PanelItemViewItem: fcn = &Style::drawPanelItemViewItemPrimitive; break;
-            case PE_IndicatorCheckBox: fcn = &Style::drawIndicatorCheckBoxPrimitive; break;
-            case PE_IndicatorRadioButton: fcn = &Style::drawIndicatorRadioButtonPrimitive; break;
-            case PE_IndicatorButtonDropDown: fcn = &Style::drawIndicatorButtonDropDownPrimitive; break;
-            case PE_IndicatorTabClose: fcn = &Style::drawIndicatorTabClosePrimitive; break;
-            case PE_IndicatorTabTear: fcn = &Style::drawIndicatorTabTearPrimitive; break;
-            case PE_IndicatorArrowUp: fcn = &Style::drawIndicatorArrowUpPrimitive; break;
-            case PE_IndicatorArrowDown: fcn = &Style::drawIndicatorArrowDownPrimitive; break;
-            case PE_IndicatorArrowLeft: fcn = &Style::drawIndicatorArrowLeftPrimitive; break;
-            case PE_IndicatorArrowRight: fcn = &Style::drawIndicatorArrowRightPrimitive; break;
-            case PE_IndicatorHeaderArrow: fcn = &Style::drawIndicatorHeaderArrowPrimitive; break;
-            case PE_IndicatorToolBarHandle: fcn = &Style::drawIndicatorToolBarHandlePrimitive; break;
-            case PE_IndicatorToolBarSeparator: fcn = &Style::drawIndicatorToolBarSeparatorPrimitive; break;
-            case PE_IndicatorBranch: fcn = &Style::drawIndicatorBranchPrimitive; break;
-            case PE_FrameStatusBar: fcn = &Style::emptyPrimitive; break;
-            case PE_Frame: fcn = &Style::drawFramePrimitive; break;
-            case PE_FrameLineEdit: fcn = &Style::drawFrameLineEditPrimitive; break;
-            case PE_FrameMenu: fcn = &Style::drawFrameMenuPrimitive; break;
-            case PE_FrameGroupBox: fcn = &Style::drawFrameGroupBoxPrimitive; break;
-            case PE_FrameTabWidget: fcn = &Style::drawFrameTabWidgetPrimitive; break;
-            case PE_FrameTabBarBase: fcn = &Style::drawFrameTabBarBasePrimitive; break;
-            case PE_FrameWindow: fcn = &Style::drawFrameWindowPrimitive; break;
-            case PE_FrameFocusRect: fcn = _frameFocusPrimitive; break;
+        static const DispatchTable<ComplexControl, StyleComplexControl, 64> table( entries );
+        return table.find( element );
 
-            // fallback
-            default: break;
+    }
+
+    //______________________________________________________________
+    void Style::drawPrimitive( PrimitiveElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget ) const
+    {
+
+        auto entry( element == PE_FrameFocusRect ? _frameFocusPrimitive : primitiveDispatchEntry( element ) );
+
+        // nothing to paint
+        if( entry.flags & DispatchEmpty ) return;
 
+        // functions that restore painter state themselves are called without saving it
+        if( entry.flags & DispatchKeepsPainter )
+        {
+            if( (this->*entry.function)( option, painter, widget ) ) return;
+            entry.function = nullptr;
         }
 
         painter->save();
 
         // call function if implemented
-        if( !( fcn && fcn( *this, option, painter, widget ) ) )
+        if( !( entry.function && (this->*entry.function)( option, painter, widget ) ) )
         { ParentStyleClass::drawPrimitive( element, option, painter, widget ); }
 
         painter->restore();
@@ -891,57 +983,28 @@ namespace Breeze
     void Style::drawControl( ControlElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget ) const
     {
 
-        StyleControl fcn;
+        ControlDispatchEntry entry;
 
         #if BREEZE_HAVE_KSTYLE||BREEZE_USE_KDE4
-        if( element == CE_CapacityBar )
-        {
-            fcn = &Style::drawProgressBarControl;
-
-        } else
+        if( element == CE_CapacityBar ) entry = { element, &Style::drawProgressBarControl, 0 };
+        else
         #endif
+        entry = controlDispatchEntry( element );
 
-        switch( element ) {
-
-            case CE_PushButtonBevel: fcn = &Style::drawPanelButtonCommandPrimitive; break;
-            case CE_PushButtonLabel: fcn = &Style::drawPushButtonLabelControl; break;
-            case CE_CheckBoxLabel: fcn = &Style::drawCheckBoxLabelControl; break;
-            case CE_RadioButtonLabel: fcn = &Style::drawCheckBoxLabelControl; break;
-            case CE_ToolButtonLabel: fcn = &Style::drawToolButtonLabelControl; break;
-            case CE_ComboBoxLabel: fcn = &Style::drawComboBoxLabelControl; break;
-            case CE_MenuBarEmptyArea: fcn = &Style::emptyControl; break;
-            case CE_MenuBarItem: fcn = &Style::drawMenuBarItemControl; break;
-            case CE_MenuItem: fcn = &Style::drawMenuItemControl; break;
-            case CE_ToolBar: fcn = &Style::emptyControl; break;
-            case CE_ProgressBar: fcn = &Style::drawProgressBarControl; break;
-            case CE_ProgressBarContents: fcn = &Style::drawProgressBarContentsControl; break;
-            case CE_ProgressBarGroove: fcn = &Style::drawProgressBarGrooveControl; break;
-            case CE_ProgressBarLabel: fcn = &Style::drawProgressBarLabelControl; break;
-            case CE_ScrollBarSlider: fcn = &Style::drawScrollBarSliderControl; break;
-            case CE_ScrollBarAddLine: fcn = &Style::drawScrollBarAddLineControl; break;
-            case CE_ScrollBarSubLine: fcn = &Style::drawScrollBarSubLineControl; break;
-            case CE_ScrollBarAddPage: fcn = &Style::emptyControl; break;
-            case CE_ScrollBarSubPage: fcn = &Style::emptyControl; break;
-            case CE_ShapedFrame: fcn = &Style::drawShapedFrameControl; break;
-            case CE_RubberBand: fcn = &Style::drawRubberBandControl; break;
-            case CE_SizeGrip: fcn = &Style::emptyControl; break;
-            case CE_HeaderSection: fcn = &Style::drawHeaderSectionControl; break;
-            case CE_HeaderEmptyArea: fcn = &Style::drawHeaderEmptyAreaControl; break;
-            case CE_TabBarTabLabel: fcn = &Style::drawTabBarTabLabelControl; break;
-            case CE_TabBarTabShape: fcn = &Style::drawTabBarTabShapeControl; break;
-            case CE_ToolBoxTabLabel: fcn = &Style::drawToolBoxTabLabelControl; break;
-            case CE_ToolBoxTabShape: fcn = &Style::drawToolBoxTabShapeControl; break;
-            case CE_DockWidgetTitle: fcn = &Style::drawDockWidgetTitleControl; break;
-
-            // fallback
-            default: break;
+        // nothing to paint
+        if( entry.flags & DispatchEmpty ) return;
 
+        // functions that restore painter state themselves are called without saving it
+        if( entry.flags & DispatchKeepsPainter )
+        {
+            if( (this->*entry.function)( option, painter, widget ) ) return;
+            entry.function = nullptr;
         }
 
         painter->save();
 
         // call function if implemented
-        if( !( fcn && fcn( *this, option, painter, widget ) ) )
+        if( !( entry.function && (this->*entry.function)( option, painter, widget ) ) )
         { ParentStyleClass::drawControl( element, option, painter, widget ); }
 
         painter->restore();
@@ -952,34 +1015,28 @@ namespace Breeze
     void Style::drawComplexControl( ComplexControl element, const QStyleOptionComplex* option, QPainter* painter, const QWidget* widget ) const
     {
 
-        StyleComplexControl fcn;
-        switch( element )
-        {
-            case CC_GroupBox: fcn = &Style::drawGroupBoxComplexControl; break;
-            case CC_ToolButton: fcn = &Style::drawToolButtonComplexControl; break;
-            case CC_ComboBox: fcn = &Style::drawComboBoxComplexControl; break;
-            case CC_SpinBox: fcn = &Style::drawSpinBoxComplexControl; break;
-            case CC_Slider: fcn = &Style::drawSliderComplexControl; break;
-            case CC_Dial: fcn = &Style::drawDialComplexControl; break;
-            case CC_ScrollBar: fcn = &Style::drawScrollBarComplexControl; break;
-            case CC_TitleBar: fcn = &Style::drawTitleBarComplexControl; break;
+        auto entry( complexControlDispatchEntry( element ) );
 
-            // fallback
-            default: break;
-        }
+        // nothing to paint
+        if( entry.flags & DispatchEmpty ) return;
 
+        // functions that restore painter state themselves are called without saving it
+        if( entry.flags & DispatchKeepsPainter )
+        {
+            if( (this->*entry.function)( option, painter, widget ) ) return;
+            entry.function = nullptr;
+        }
 
         painter->save();
 
         // call function if implemented
-        if( !( fcn && fcn( *this, option, painter, widget ) ) )
+        if( !( entry.function && (this->*entry.function)( option, painter, widget ) ) )
         { ParentStyleClass::drawComplexControl( element, option, painter, widget ); }
 
         painter->restore();
 
     }
 
-
     //___________________________________________________________________________________
     void Style::drawItemText(
         QPainter* painter, const QRect& rect, int flags, const QPalette& palette, bool enabled,
@@ -1032,8 +1089,9 @@ namespace Breeze
         #endif
         // cast to QWidget
         QWidget *widget = static_cast<QWidget*>( object );
-        if( widget->inherits( "QAbstractScrollArea" ) || widget->inherits( "KTextEditor::View" ) ) { return eventFilterScrollArea( widget, event ); }
-        else if( widget->inherits( "QComboBoxPrivateContainer" ) ) { return eventFilterComboBoxContainer( widget, event ); }
+        const WidgetRoles roles( widgetRoles( widget ) );
+        if( roles & ( RoleAbstractScrollArea | RoleKTextEditorView ) ) { return eventFilterScrollArea( widget, event ); }
+        else if( roles & RoleComboBoxPrivateContainer ) { return eventFilterComboBoxContainer( widget, event ); }
 
         // fallback
         return ParentStyleClass::eventFilter( object, event );
@@ -1046,6 +1104,16 @@ namespace Breeze
 
         switch( event->type() )
         {
+            case QEvent::ChildAdded:
+            case QEvent::ChildRemoved:
+            case QEvent::StyleChange:
+            {
+                // invalidate cached children and settings
+                ScrollAreaDataMap::iterator iter( _scrollAreaData.find( widget ) );
+                if( iter != _scrollAreaData.end() ) iter.value()._dirty = true;
+                break;
+            }
+
             case QEvent::Paint:
             {
 
@@ -1055,16 +1123,17 @@ namespace Breeze
                 if( !( scrollArea && (viewport = scrollArea->viewport()) ) ) break;
 
                 // get scrollarea horizontal and vertical containers
+                const ScrollAreaData& data( scrollAreaData( widget ) );
                 QWidget* child( nullptr );
                 QList<QWidget*> children;
-                if( ( child = scrollArea->findChild<QWidget*>( "qt_scrollarea_vcontainer" ) ) && child->isVisible() )
+                if( ( child = data._verticalContainer.data() ) && child->isVisible() )
                 { children.append( child ); }
 
-                if( ( child = scrollArea->findChild<QWidget*>( "qt_scrollarea_hcontainer" ) ) && child->isVisible() )
+                if( ( child = data._horizontalContainer.data() ) && child->isVisible() )
                 { children.append( child ); }
 
                 if( children.empty() ) break;
-                if( !scrollArea->styleSheet().isEmpty() ) break;
+                if( data._hasStyleSheet ) break;
 
                 // make sure proper background is rendered behind the containers
                 QPainter painter( scrollArea );
@@ -1095,7 +1164,8 @@ namespace Breeze
                 QMouseEvent* mouseEvent( static_cast<QMouseEvent*>( event ) );
 
                 // get frame framewidth
-                const int frameWidth( pixelMetric( PM_DefaultFrameWidth, nullptr, widget ) );
+                const ScrollAreaData& data( scrollAreaData( widget ) );
+                const int frameWidth( data._frameWidth );
 
                 // find list of scrollbars
                 QList<QScrollBar*> scrollBars;
@@ -1105,8 +1175,10 @@ namespace Breeze
                     if( scrollArea->horizontalScrollBarPolicy() != Qt::ScrollBarAlwaysOff ) scrollBars.append( scrollArea->horizontalScrollBar() );
                     if( scrollArea->verticalScrollBarPolicy() != Qt::ScrollBarAlwaysOff )scrollBars.append( scrollArea->verticalScrollBar() );
 
-                } else if( widget->inherits( "KTextEditor::View" ) ) {
+                } else {
 
+                    // KTextEditor views. Scrollbars are searched on each event, since they can be added
+                    // or removed anywhere in the view's children hierarchy
                     scrollBars = widget->findChildren<QScrollBar*>();
 
                 }
@@ -1153,6 +1225,46 @@ namespace Breeze
 
     }
 
+    //_________________________________________________________
+    Style::ScrollAreaData& Style::scrollAreaData( QWidget* widget )
+    {
+
+        ScrollAreaDataMap::iterator iter( _scrollAreaData.find( widget ) );
+        if( iter == _scrollAreaData.end() || iter.value()._widget.data() != widget )
+        {
+
+            // new widget, or entry left over by a deleted widget with the same address
+            ScrollAreaData data;
+            data._widget = widget;
+            iter = _scrollAreaData.insert( widget, data );
+            connect( widget, SIGNAL(destroyed(QObject*)), SLOT(scrollAreaDestroyed(QObject*)), Qt::UniqueConnection );
+
+        }
+
+        ScrollAreaData& data( iter.value() );
+        if( !data._dirty ) return data;
+
+        // containers are direct children of the scroll area
+        data._verticalContainer.clear();
+        data._horizontalContainer.clear();
+        foreach( QObject* child, widget->children() )
+        {
+            if( !child->isWidgetType() ) continue;
+            else if( child->objectName() == QLatin1String( "qt_scrollarea_vcontainer" ) ) data._verticalContainer = static_cast<QWidget*>( child );
+            else if( child->objectName() == QLatin1String( "qt_scrollarea_hcontainer" ) ) data._horizontalContainer = static_cast<QWidget*>( child );
+        }
+
+        data._hasStyleSheet = !widget->styleSheet().isEmpty();
+        data._frameWidth = pixelMetric( PM_DefaultFrameWidth, nullptr, widget );
+        data._dirty = false;
+        return data;
+
+    }
+
+    //_________________________________________________________
+    void Style::scrollAreaDestroyed( QObject* object )
+    { _scrollAreaData.remove( object ); }
+
     //_________________________________________________________
     bool Style::eventFilterComboBoxContainer( QWidget* widget, QEvent* event )
     {
@@ -1370,8 +1482,16 @@ namespace Breeze
     QIcon Style::standardIconImplementation( StandardPixmap standardPixmap, const QStyleOption* option, const QWidget* widget ) const
     {
 
-        // lookup cache
-        if( _iconCache.contains( standardPixmap ) ) return _iconCache.value( standardPixmap );
+        // store palette
+        // due to Qt, it is not always safe to assume that either option, nor widget are defined
+        QPalette palette;
+        if( option ) palette = option->palette;
+        else if( widget ) palette = widget->palette();
+        else palette = QApplication::palette();
+
+        // lookup cache, icons are discarded when palette changes
+        const IconCache::const_iterator iter( _iconCache.constFind( standardPixmap ) );
+        if( iter != _iconCache.constEnd() && iter.value().first == palette.cacheKey() ) return iter.value().second;
 
         QIcon icon;
         switch( standardPixmap )
@@ -1382,12 +1502,9 @@ namespace Breeze
             case SP_TitleBarMaxButton:
             case SP_TitleBarCloseButton:
             case SP_DockWidgetCloseButton:
-            icon = titleBarButtonIcon( standardPixmap, option, widget );
-            break;
-
             case SP_ToolBarHorizontalExtensionButton:
             case SP_ToolBarVerticalExtensionButton:
-            icon = toolBarExtensionIcon( standardPixmap, option, widget );
+            icon = QIcon( new IconEngine( this, standardPixmap, palette ) );
             break;
 
             default:
@@ -1406,12 +1523,35 @@ namespace Breeze
             #endif
 
         } else {
-            const_cast<IconCache*>(&_iconCache)->insert( standardPixmap, icon );
+            const_cast<IconCache*>(&_iconCache)->insert( standardPixmap, qMakePair( palette.cacheKey(), icon ) );
             return icon;
         }
 
     }
 
+    //____________________________________________________________________
+    void Style::renderStandardIcon( QPainter* painter, const QRect& rect, StandardPixmap standardPixmap, const QPalette& palette, QIcon::Mode mode, QIcon::State state ) const
+    {
+        switch( standardPixmap )
+        {
+
+            case SP_TitleBarNormalButton:
+            case SP_TitleBarMinButton:
+            case SP_TitleBarMaxButton:
+            case SP_TitleBarCloseButton:
+            case SP_DockWidgetCloseButton:
+            return renderTitleBarButtonIcon( painter, rect, standardPixmap, palette, mode, state );
+
+            case SP_ToolBarHorizontalExtensionButton:
+            case SP_ToolBarVerticalExtensionButton:
+            return renderToolBarExtensionIcon( painter, rect, standardPixmap, palette, mode, state );
+
+            default: return;
+
+        }
+
+    }
+
     //_____________________________________________________________________
     void Style::loadConfiguration()
     {
@@ -1429,6 +1569,9 @@ namespace Breeze
         // splitter proxy
         _splitterFactory->setEnabled( StyleConfigData::splitterProxyEnabled() );
 
+        // frame shadows
+        _frameShadowFactory->setOverlaysEnabled( StyleConfigData::frameOverlaysEnabled() );
+
         // reset shadow tiles
         _shadowHelper->loadConfig();
 
@@ -1458,8 +1601,8 @@ namespace Breeze
         }
 
         // frame focus
-        if( StyleConfigData::viewDrawFocusIndicator() ) _frameFocusPrimitive = &Style::drawFrameFocusRectPrimitive;
-        else _frameFocusPrimitive = &Style::emptyPrimitive;
+        if( StyleConfigData::viewDrawFocusIndicator() ) _frameFocusPrimitive = { PE_FrameFocusRect, &Style::drawFrameFocusRectPrimitive, 0 };
+        else _frameFocusPrimitive = { PE_FrameFocusRect, &Style::emptyPrimitive, DispatchEmpty };
 
         // widget explorer
         _widgetExplorer->setEnabled( StyleConfigData::widgetExplorerEnabled() );
@@ -3072,7 +3215,14 @@ namespace Breeze
 
             }
 
-            const auto background( isTitleWidget ? palette.color( widget->backgroundRole() ):QColor() );
+            auto background( isTitleWidget ? palette.color( widget->backgroundRole() ):QColor() );
+            if( _frameShadowFactory->hasMasks( widget ) )
+            {
+                // viewport corners are masked out, so that the frame must fill them with the viewport background
+                const auto viewport( static_cast<const QAbstractScrollArea*>( widget )->viewport() );
+                if( viewport && viewport->autoFillBackground() ) background = viewport->palette().color( viewport->backgroundRole() );
+            }
+
             const auto outline( _helper->frameOutlineColor( palette, mouseOver, hasFocus, opacity, mode ) );
             _helper->renderFrame( painter, rect, background, outline );
 
@@ -3756,12 +3906,9 @@ namespace Breeze
         else colorGroup = QPalette::Disabled;
 
         // render alternate background
+        // rects are filled directly, which leaves the painter untouched, so that it needs not be saved
         if( viewItemOption && ( viewItemOption->features & QStyleOptionViewItemV2::Alternate ) )
-        {
-            painter->setPen( Qt::NoPen );
-            painter->setBrush( palette.brush( colorGroup, QPalette::AlternateBase ) );
-            painter->drawRect( rect );
-        }
+        { painter->fillRect( rect, palette.brush( colorGroup, QPalette::AlternateBase ) ); }
 
         // stop here if no highlight is needed
         if( !( mouseOver || selected ||hasCustomBackground ) )
@@ -3771,10 +3918,12 @@ namespace Breeze
         if( hasCustomBackground && !hasSolidBackground )
         {
 
+            painter->save();
             painter->setBrushOrigin( viewItemOption->rect.topLeft() );
             painter->setBrush( viewItemOption->backgroundBrush );
             painter->setPen( Qt::NoPen );
             painter->drawRect( viewItemOption->rect );
+            painter->restore();
             return true;
 
         }
@@ -3794,7 +3943,6 @@ namespace Breeze
 
         // render
         _helper->renderSelection( painter, rect, color );
-
         return true;
     }
 
@@ -6943,81 +7091,32 @@ namespace Breeze
     }
 
     //____________________________________________________________________________________
-    QIcon Style::toolBarExtensionIcon( StandardPixmap standardPixmap, const QStyleOption* option, const QWidget* widget ) const
+    void Style::renderToolBarExtensionIcon( QPainter* painter, const QRect& rect, StandardPixmap standardPixmap, const QPalette& palette, QIcon::Mode mode, QIcon::State state ) const
     {
 
-        // store palette
-        // due to Qt, it is not always safe to assume that either option, nor widget are defined
-        QPalette palette;
-        if( option ) palette = option->palette;
-        else if( widget ) palette = widget->palette();
-        else palette = QApplication::palette();
-
-        // convenience class to map color to icon mode
-        struct IconData
-        {
-            QColor _color;
-            QIcon::Mode _mode;
-            QIcon::State _state;
-        };
-
-        // map colors to icon states
-        const QList<IconData> iconTypes =
-        {
-            { palette.color( QPalette::Active, QPalette::WindowText ), QIcon::Normal, QIcon::Off },
-            { palette.color( QPalette::Active, QPalette::WindowText ), QIcon::Selected, QIcon::Off },
-            { palette.color( QPalette::Active, QPalette::WindowText ), QIcon::Active, QIcon::Off },
-            { palette.color( QPalette::Disabled, QPalette::WindowText ), QIcon::Disabled, QIcon::Off },
-
-            { palette.color( QPalette::Active, QPalette::HighlightedText ), QIcon::Normal, QIcon::On },
-            { palette.color( QPalette::Active, QPalette::HighlightedText ), QIcon::Selected, QIcon::On },
-            { palette.color( QPalette::Active, QPalette::WindowText ), QIcon::Active, QIcon::On },
-            { palette.color( QPalette::Disabled, QPalette::WindowText ), QIcon::Disabled, QIcon::On }
-        };
-
-        // default icon sizes
-        static const QList<int> iconSizes = { 8, 16, 22, 32, 48 };
+        // map icon mode and state to color
+        QColor color;
+        if( mode == QIcon::Disabled ) color = palette.color( QPalette::Disabled, QPalette::WindowText );
+        else if( state == QIcon::On && mode != QIcon::Active ) color = palette.color( QPalette::Active, QPalette::HighlightedText );
+        else color = palette.color( QPalette::Active, QPalette::WindowText );
 
         // decide arrow orientation
         const ArrowOrientation orientation( standardPixmap == SP_ToolBarHorizontalExtensionButton ? ArrowRight : ArrowDown );
 
-        // create icon and fill
-        QIcon icon;
-        foreach( const IconData& iconData, iconTypes )
-        {
-
-            foreach( const int& iconSize, iconSizes )
-            {
-
-                // create pixmap
-                QPixmap pixmap( iconSize, iconSize );
-                pixmap.fill( Qt::transparent );
-
-                // render
-                QPainter painter( &pixmap );
-
-                // icon size
-                const int fixedIconSize( pixelMetric( QStyle::PM_SmallIconSize, option, widget ) );
-                const QRect fixedRect( 0, 0, fixedIconSize, fixedIconSize );
-
-                painter.setWindow( fixedRect );
-                painter.translate( standardPixmap == SP_ToolBarHorizontalExtensionButton ? QPoint( 1, 0 ) : QPoint( 0, 1 ) );
-                _helper->renderArrow( &painter, fixedRect, iconData._color, orientation );
-                painter.end();
-
-                // add to icon
-                icon.addPixmap( pixmap, iconData._mode, iconData._state );
-
-            }
-
-        }
+        // icon size
+        const int fixedIconSize( pixelMetric( QStyle::PM_SmallIconSize ) );
+        const QRect fixedRect( 0, 0, fixedIconSize, fixedIconSize );
 
-        return icon;
+        // render
+        painter->setViewport( rect );
+        painter->setWindow( fixedRect );
+        painter->translate( standardPixmap == SP_ToolBarHorizontalExtensionButton ? QPoint( 1, 0 ) : QPoint( 0, 1 ) );
+        _helper->renderArrow( painter, fixedRect, color, orientation );
 
     }
 
     //____________________________________________________________________________________
-    QIcon Style::titleBarButtonIcon( StandardPixmap standardPixmap, const QStyleOption* option, const QWidget* widget ) const
+    void Style::renderTitleBarButtonIcon( QPainter* painter, const QRect& rect, StandardPixmap standardPixmap, QPalette palette, QIcon::Mode mode, QIcon::State state ) const
     {
 
         // map standardPixmap to button type
@@ -7032,19 +7131,13 @@ namespace Breeze
             buttonType = ButtonClose;
             break;
 
-            default: return QIcon();
+            default: return;
         }
 
-        // store palette
-        // due to Qt, it is not always safe to assume that either option, nor widget are defined
-        QPalette palette;
-        if( option ) palette = option->palette;
-        else if( widget ) palette = widget->palette();
-        else palette = QApplication::palette();
-
         const bool isCloseButton( buttonType == ButtonClose && StyleConfigData::outlineCloseButton() );
 
         palette.setCurrentColorGroup( QPalette::Active );
+        const auto window( palette.color( QPalette::Window ) );
         const auto base( palette.color( QPalette::WindowText ) );
         const auto selected( palette.color( QPalette::HighlightedText ) );
         const auto negative( buttonType == ButtonClose ? _helper->negativeText( palette ):base );
@@ -7052,61 +7145,31 @@ namespace Breeze
 
         const bool invertNormalState( isCloseButton );
 
-        // convenience class to map color to icon mode
-        struct IconData
+        // map icon mode and state to color and inversion
+        QColor color;
+        bool inverted( invertNormalState );
+        if( mode == QIcon::Disabled )
         {
-            QColor _color;
-            bool _inverted;
-            QIcon::Mode _mode;
-            QIcon::State _state;
-        };
 
-        // map colors to icon states
-        const QList<IconData> iconTypes =
-        {
+            color = KColorUtils::mix( window, base, 0.2 );
 
-            // state off icons
-            { KColorUtils::mix( palette.color( QPalette::Window ), base,  0.5 ), invertNormalState, QIcon::Normal, QIcon::Off },
-            { KColorUtils::mix( palette.color( QPalette::Window ), selected, 0.5 ), invertNormalState, QIcon::Selected, QIcon::Off },
-            { KColorUtils::mix( palette.color( QPalette::Window ), negative, 0.5 ), true, QIcon::Active, QIcon::Off },
-            { KColorUtils::mix( palette.color( QPalette::Window ), base, 0.2 ), invertNormalState, QIcon::Disabled, QIcon::Off },
+        } else if( state == QIcon::On ) {
 
-            // state on icons
-            { KColorUtils::mix( palette.color( QPalette::Window ), negative, 0.7 ), true, QIcon::Normal, QIcon::On },
-            { KColorUtils::mix( palette.color( QPalette::Window ), negativeSelected, 0.7 ), true, QIcon::Selected, QIcon::On },
-            { KColorUtils::mix( palette.color( QPalette::Window ), negative, 0.7 ), true, QIcon::Active, QIcon::On },
-            { KColorUtils::mix( palette.color( QPalette::Window ), base, 0.2 ), invertNormalState, QIcon::Disabled, QIcon::On }
+            color = KColorUtils::mix( window, mode == QIcon::Selected ? negativeSelected:negative, 0.7 );
+            inverted = true;
 
-        };
+        } else if( mode == QIcon::Active ) {
 
-        // default icon sizes
-        static const QList<int> iconSizes = { 8, 16, 22, 32, 48 };
+            color = KColorUtils::mix( window, negative, 0.5 );
+            inverted = true;
 
-        // output icon
-        QIcon icon;
-
-        foreach( const IconData& iconData, iconTypes )
-        {
-
-            foreach( const int& iconSize, iconSizes )
-            {
-                // create pixmap
-                QPixmap pixmap( iconSize, iconSize );
-                pixmap.fill( Qt::transparent );
-
-                // create painter and render
-                QPainter painter( &pixmap );
-                _helper->renderDecorationButton( &painter, pixmap.rect(), iconData._color, buttonType, iconData._inverted );
-
-                painter.end();
+        } else {
 
-                // store
-                icon.addPixmap( pixmap, iconData._mode, iconData._state );
-            }
+            color = KColorUtils::mix( window, mode == QIcon::Selected ? selected:base, 0.5 );
 
         }
 
-        return icon;
+        _helper->renderDecorationButton( painter, rect, color, buttonType, inverted );
 
     }
 
@@ -47,8 +47,6 @@
 #include <QCommandLinkButton>
 #endif
 
-#include <functional>
-
 namespace BreezePrivate
 {
     class TabBarData;
@@ -141,6 +139,9 @@ namespace Breeze
             QPainter*, const QRect&, int alignment, const QPalette&, bool enabled,
             const QString&, QPalette::ColorRole = QPalette::NoRole) const override;
 
+        //* render standard icon for a given mode and state, used by IconEngine
+        void renderStandardIcon( QPainter*, const QRect&, StandardPixmap, const QPalette&, QIcon::Mode, QIcon::State ) const;
+
         //*@name event filters
         //@{
 
@@ -168,6 +169,9 @@ namespace Breeze
         //* update configuration
         void configurationChanged();
 
+        //* remove cached scroll area children
+        void scrollAreaDestroyed( QObject* );
+
         //* standard icons
         QIcon standardIconImplementation( StandardPixmap, const QStyleOption*, const QWidget* ) const;
 
@@ -388,11 +392,11 @@ namespace Breeze
         */
         QStyleOptionToolButton separatorMenuItemOption( const QStyleOptionMenuItem*, const QWidget* ) const;
 
-        //* create toolbar extension icon
-        QIcon toolBarExtensionIcon( StandardPixmap, const QStyleOption*, const QWidget* ) const;
+        //* render toolbar extension icon
+        void renderToolBarExtensionIcon( QPainter*, const QRect&, StandardPixmap, const QPalette&, QIcon::Mode, QIcon::State ) const;
 
-        //* create title bar button icon
-        QIcon titleBarButtonIcon( StandardPixmap, const QStyleOption*, const QWidget* ) const;
+        //* render title bar button icon
+        void renderTitleBarButtonIcon( QPainter*, const QRect&, StandardPixmap, QPalette, QIcon::Mode, QIcon::State ) const;
 
         //* returns item view parent if any
         /** needed to have correct color on focused checkboxes and radiobuttons */
@@ -523,19 +527,107 @@ namespace Breeze
         //* tabbar data
         BreezePrivate::TabBarData* _tabBarData = nullptr;
 
-        //* icon hash
-        using IconCache = QHash<StandardPixmap, QIcon>;
+        //* scroll area children and settings, cached for the scroll area event filter
+        class ScrollAreaData
+        {
+            public:
+
+            //* scroll area, used to detect entries left over by a deleted widget
+            WeakPointer<QWidget> _widget;
+
+            //* true when cached values must be updated
+            bool _dirty = true;
+
+            //*@name scrollbar containers
+            //@{
+            WeakPointer<QWidget> _verticalContainer;
+            WeakPointer<QWidget> _horizontalContainer;
+            //@}
+
+            //* true if scroll area has a style sheet
+            bool _hasStyleSheet = false;
+
+            //* frame width
+            int _frameWidth = 0;
+
+        };
+
+        //* get cached scroll area data, updated if needed
+        ScrollAreaData& scrollAreaData( QWidget* );
+
+        //* scroll area data, by scroll area
+        using ScrollAreaDataMap = QHash<const QObject*, ScrollAreaData>;
+        ScrollAreaDataMap _scrollAreaData;
+
+        //* icon hash, with cache key of the palette used to create the icon
+        using IconCache = QHash<StandardPixmap, QPair<qint64, QIcon>>;
         IconCache _iconCache;
 
         //* pointer to primitive specialized function
-        using StylePrimitive = std::function<bool(const Style&, const QStyleOption*, QPainter*, const QWidget*)>;
-        StylePrimitive _frameFocusPrimitive;
+        using StylePrimitive = bool (Style::*)( const QStyleOption*, QPainter*, const QWidget* ) const;
 
         //* pointer to control specialized function
-        using StyleControl = std::function<bool(const Style&, const QStyleOption*, QPainter*, const QWidget*)>;
+        using StyleControl = bool (Style::*)( const QStyleOption*, QPainter*, const QWidget* ) const;
 
         //* pointer to control specialized function
-        using StyleComplexControl = std::function<bool(const Style&, const QStyleOptionComplex*, QPainter*, const QWidget*)>;
+        using StyleComplexControl = bool (Style::*)( const QStyleOptionComplex*, QPainter*, const QWidget* ) const;
+
+        //* specialized function flags
+        enum DispatchFlag
+        {
+            //* function paints nothing. The painter is not touched at all
+            DispatchEmpty = 1<<0,
+
+            //* function restores any painter state it changes, so that the painter needs not be saved
+            DispatchKeepsPainter = 1<<1
+        };
+
+        //* associate style element to specialized function
+        template< typename Element, typename Function > struct DispatchEntry
+        {
+            Element element;
+            Function function;
+            int flags;
+        };
+
+        using PrimitiveDispatchEntry = DispatchEntry<PrimitiveElement, StylePrimitive>;
+        using ControlDispatchEntry = DispatchEntry<ControlElement, StyleControl>;
+        using ComplexControlDispatchEntry = DispatchEntry<ComplexControl, StyleComplexControl>;
+
+        //* specialized function lookup table, indexed by style element
+        template< typename Element, typename Function, int Size > class DispatchTable
+        {
+            public:
+
+            using Entry = DispatchEntry<Element, Function>;
+
+            //* constructor
+            template< size_t N > explicit DispatchTable( const Entry (&entries)[N] )
+            {
+                for( const auto& entry:entries )
+                { if( entry.element >= 0 && entry.element < Size ) _entries[entry.element] = entry; }
+            }
+
+            //* lookup. Returns an entry with no function for unhandled elements
+            Entry find( Element element ) const
+            { return ( element >= 0 && element < Size ) ? _entries[element] : Entry(); }
+
+            private:
+
+            //* entries
+            Entry _entries[Size] = {};
+
+        };
+
+        //*@name specialized function lookup
+        //@{
+        static PrimitiveDispatchEntry primitiveDispatchEntry( PrimitiveElement );
+        static ControlDispatchEntry controlDispatchEntry( ControlElement );
+        static ComplexControlDispatchEntry complexControlDispatchEntry( ComplexControl );
+        //@}
+
+        //* frame focus primitive, depends on configuration
+        PrimitiveDispatchEntry _frameFocusPrimitive;
 
         //*@name custom elements
         //@{
@@ -0,0 +1,190 @@
+/*************************************************************************
+ * Copyright (C) 2026 by agent <agent@local>                             *
+ *                                                                       *
+ * This program is free software; you can redistribute it and/or modify  *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation; either version 2 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * This program is distributed in the hope that it will be useful,       *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have received a copy of the GNU General Public License     *
+ * along with this program; if not, write to the                         *
+ * Free Software Foundation, Inc.,                                       *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA .        *
+ *************************************************************************/
+
+#include "breezewidgetroles.h"
+
+#include <QAbstractItemView>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDial>
+#include <QDockWidget>
+#include <QGroupBox>
+#include <QHash>
+#include <QHeaderView>
+#include <QLineEdit>
+#include <QList>
+#include <QMainWindow>
+#include <QMdiSubWindow>
+#include <QMenu>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QRadioButton>
+#include <QScrollBar>
+#include <QSlider>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QStackedWidget>
+#include <QTabBar>
+#include <QTextEdit>
+#include <QToolBar>
+#include <QToolBox>
+#include <QToolButton>
+
+#if QT_VERSION >= 0x050000
+#include <QCommandLinkButton>
+#endif
+
+namespace Breeze
+{
+
+    //* role associated to a given Qt class
+    struct MetaObjectRole
+    {
+        const QMetaObject* _metaObject;
+        WidgetRole _role;
+    };
+
+    //* role associated to a class outside of Qt, or private, matched by name
+    struct ClassNameRole
+    {
+        const char* _className;
+        WidgetRole _role;
+    };
+
+    //* Qt classes with a role
+    /** these are static meta objects, valid for the whole application lifetime */
+    static const MetaObjectRole qtClassRoles[] =
+    {
+        { &QAbstractButton::staticMetaObject, RoleAbstractButton },
+        { &QPushButton::staticMetaObject, RolePushButton },
+        { &QToolButton::staticMetaObject, RoleToolButton },
+        { &QCheckBox::staticMetaObject, RoleCheckBox },
+        { &QRadioButton::staticMetaObject, RoleRadioButton },
+        #if QT_VERSION >= 0x050000
+        { &QCommandLinkButton::staticMetaObject, RoleCommandLinkButton },
+        #endif
+        { &QAbstractScrollArea::staticMetaObject, RoleAbstractScrollArea },
+        { &QAbstractItemView::staticMetaObject, RoleAbstractItemView },
+        { &QHeaderView::staticMetaObject, RoleHeaderView },
+        { &QTextEdit::staticMetaObject, RoleTextEdit },
+        { &QAbstractSpinBox::staticMetaObject, RoleAbstractSpinBox },
+        { &QSpinBox::staticMetaObject, RoleSpinBox },
+        { &QComboBox::staticMetaObject, RoleComboBox },
+        { &QLineEdit::staticMetaObject, RoleLineEdit },
+        { &QDial::staticMetaObject, RoleDial },
+        { &QSlider::staticMetaObject, RoleSlider },
+        { &QScrollBar::staticMetaObject, RoleScrollBar },
+        { &QProgressBar::staticMetaObject, RoleProgressBar },
+        { &QFrame::staticMetaObject, RoleFrame },
+        { &QGroupBox::staticMetaObject, RoleGroupBox },
+        { &QTabBar::staticMetaObject, RoleTabBar },
+        { &QToolBox::staticMetaObject, RoleToolBox },
+        { &QStackedWidget::staticMetaObject, RoleStackedWidget },
+        { &QSplitter::staticMetaObject, RoleSplitter },
+        { &QSplitterHandle::staticMetaObject, RoleSplitterHandle },
+        { &QDockWidget::staticMetaObject, RoleDockWidget },
+        { &QMdiSubWindow::staticMetaObject, RoleMdiSubWindow },
+        { &QMainWindow::staticMetaObject, RoleMainWindow },
+        { &QMenu::staticMetaObject, RoleMenu },
+        { &QToolBar::staticMetaObject, RoleToolBar }
+    };
+
+    //* classes with a role, matched by name
+    static const ClassNameRole namedClassRoles[] =
+    {
+        { "QComboBoxPrivateContainer", RoleComboBoxPrivateContainer },
+        { "QTipLabel", RoleTipLabel },
+        { "KTextEditor::View", RoleKTextEditorView },
+        { "KTitleWidget", RoleKTitleWidget },
+        { "KHTMLView", RoleKHTMLView },
+        { "KMainWindow", RoleKMainWindow },
+        { "Plasma::ToolTip", RolePlasmaToolTip }
+    };
+
+    //____________________________________________________________________
+    //* role of a single class matched by name, not including its ancestors
+    static WidgetRoles namedClassRole( const QMetaObject* metaObject )
+    {
+
+        for( const ClassNameRole& classNameRole : namedClassRoles )
+        { if( !qstrcmp( metaObject->className(), classNameRole._className ) ) return classNameRole._role; }
+
+        return RoleNone;
+
+    }
+
+    //____________________________________________________________________
+    //* roles of the Qt classes with a role and of all their ancestors, including their own ancestors' roles
+    /**
+    all these meta objects are static, so that they can safely be cached by address.
+    Meta objects created at runtime, e.g. for QML or Python types, can be freed and their address reused,
+    so they are never used as keys
+    */
+    static QHash<const QMetaObject*, WidgetRoles> createStaticRoles()
+    {
+
+        QHash<const QMetaObject*, WidgetRoles> ownRoles;
+        for( const MetaObjectRole& metaObjectRole : qtClassRoles )
+        { ownRoles.insert( metaObjectRole._metaObject, metaObjectRole._role ); }
+
+        QHash<const QMetaObject*, WidgetRoles> out;
+        for( const MetaObjectRole& metaObjectRole : qtClassRoles )
+        {
+
+            // collect class hierarchy, up to the first class already stored
+            QList<const QMetaObject*> hierarchy;
+            for( const QMetaObject* current = metaObjectRole._metaObject; current && !out.contains( current ); current = current->superClass() )
+            { hierarchy.prepend( current ); }
+
+            // store roles, from base class down
+            for( const QMetaObject* current : hierarchy )
+            {
+                const WidgetRoles roles( ownRoles.value( current, RoleNone ) | namedClassRole( current ) );
+                out.insert( current, roles | out.value( current->superClass(), RoleNone ) );
+            }
+
+        }
+
+        return out;
+
+    }
+
+    //____________________________________________________________________
+    WidgetRoles metaObjectRoles( const QMetaObject* metaObject )
+    {
+
+        static const QHash<const QMetaObject*, WidgetRoles> staticRoles( createStaticRoles() );
+
+        // walk class hierarchy up to the first static class with known roles
+        WidgetRoles roles( RoleNone );
+        for( const QMetaObject* current = metaObject; current; current = current->superClass() )
+        {
+
+            const QHash<const QMetaObject*, WidgetRoles>::const_iterator iter( staticRoles.constFind( current ) );
+            if( iter != staticRoles.constEnd() ) return roles | iter.value();
+
+            roles |= namedClassRole( current );
+
+        }
+
+        return roles;
+
+    }
+
+}
@@ -0,0 +1,89 @@
+#ifndef breezewidgetroles_h
+#define breezewidgetroles_h
+
+/*************************************************************************
+ * Copyright (C) 2026 by agent <agent@local>                             *
+ *                                                                       *
+ * This program is free software; you can redistribute it and/or modify  *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation; either version 2 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * This program is distributed in the hope that it will be useful,       *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have received a copy of the GNU General Public License     *
+ * along with this program; if not, write to the                         *
+ * Free Software Foundation, Inc.,                                       *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA .        *
+ *************************************************************************/
+
+#include <QMetaObject>
+#include <QObject>
+
+namespace Breeze
+{
+
+    //* widget classes relevant to the style, as a bitmask
+    /**
+    roles include the class and all its ancestors, and are used in place of repeated qobject_cast and inherits() calls when polishing widgets.
+    They are precomputed for the Qt classes the style knows about; other classes are walked up to the nearest of these.
+    Checks that depend on a widget's parent must be done on the parent's roles
+    */
+    enum WidgetRole: quint64
+    {
+        RoleNone = 0,
+        RoleAbstractButton = 1ULL<<0,
+        RolePushButton = 1ULL<<1,
+        RoleToolButton = 1ULL<<2,
+        RoleCheckBox = 1ULL<<3,
+        RoleRadioButton = 1ULL<<4,
+        RoleCommandLinkButton = 1ULL<<5,
+        RoleAbstractScrollArea = 1ULL<<6,
+        RoleAbstractItemView = 1ULL<<7,
+        RoleHeaderView = 1ULL<<8,
+        RoleTextEdit = 1ULL<<9,
+        RoleAbstractSpinBox = 1ULL<<10,
+        RoleSpinBox = 1ULL<<11,
+        RoleComboBox = 1ULL<<12,
+        RoleLineEdit = 1ULL<<13,
+        RoleDial = 1ULL<<14,
+        RoleSlider = 1ULL<<15,
+        RoleScrollBar = 1ULL<<16,
+        RoleProgressBar = 1ULL<<17,
+        RoleFrame = 1ULL<<18,
+        RoleGroupBox = 1ULL<<19,
+        RoleTabBar = 1ULL<<20,
+        RoleToolBox = 1ULL<<21,
+        RoleStackedWidget = 1ULL<<22,
+        RoleSplitter = 1ULL<<23,
+        RoleSplitterHandle = 1ULL<<24,
+        RoleDockWidget = 1ULL<<25,
+        RoleMdiSubWindow = 1ULL<<26,
+        RoleMainWindow = 1ULL<<27,
+        RoleMenu = 1ULL<<28,
+        RoleComboBoxPrivateContainer = 1ULL<<29,
+        RoleTipLabel = 1ULL<<30,
+        RoleKTextEditorView = 1ULL<<31,
+        RoleKTitleWidget = 1ULL<<32,
+        RoleKHTMLView = 1ULL<<33,
+        RoleKMainWindow = 1ULL<<34,
+        RoleToolBar = 1ULL<<35,
+        RolePlasmaToolTip = 1ULL<<36
+    };
+
+    //* combination of widget roles
+    using WidgetRoles = quint64;
+
+    //* roles for a given meta object
+    WidgetRoles metaObjectRoles( const QMetaObject* );
+
+    //* roles for a given object
+    inline WidgetRoles widgetRoles( const QObject* object )
+    { return object ? metaObjectRoles( object->metaObject() ):RoleNone; }
+
+}
+
+#endif
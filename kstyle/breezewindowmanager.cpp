@@ -83,6 +83,7 @@
 // needed to enable dragging from QQuickWindows
 #include <QQuickItem>
 #include <QQuickWindow>
+#include <QScreen>
 #endif
 
 #if BREEZE_HAVE_X11
@@ -243,6 +244,7 @@ namespace Breeze
 
         initializeWhiteList();
         initializeBlackList();
+        resolveExceptions();
         initializeWayland();
 
     }
@@ -429,6 +431,12 @@ namespace Breeze
             else if( _quickTarget ) startDrag( _quickTarget.data()->window(), _globalDragPoint );
             #endif
 
+        } else if( event->timerId() == _moveTimer.timerId() ) {
+
+            // move window once per frame, and stop when no move is requested
+            if( _movePending ) applyPendingMove();
+            else _moveTimer.stop();
+
         } else {
 
             return QObject::timerEvent( event );
@@ -534,7 +542,16 @@ namespace Breeze
             // use QWidget::move for the grabbing
             /* this works only if the sending object and the target are identical */
             auto window( _target.data()->window() );
-            window->move( window->pos() + mouseEvent->pos() - _dragPoint );
+            _pendingPosition = window->pos() + mouseEvent->pos() - _dragPoint;
+            _movePending = true;
+
+            // move immediately if idle, and coalesce following moves until next frame
+            if( !_moveTimer.isActive() )
+            {
+                applyPendingMove();
+                _moveTimer.start( moveInterval( window ), this );
+            }
+
             return true;
 
         } else return false;
@@ -547,6 +564,9 @@ namespace Breeze
 
         Q_UNUSED( object );
         Q_UNUSED( event );
+
+        // make sure window ends at the last requested position
+        applyPendingMove();
         resetDrag();
         return false;
     }
@@ -618,43 +638,72 @@ namespace Breeze
     }
 
     //_____________________________________________________________
-    bool WindowManager::isBlackListed( QWidget* widget )
+    void WindowManager::resolveExceptions()
     {
 
-        // check against noAnimations propery
-        const auto propertyValue( widget->property( PropertyNames::noWindowGrab ) );
-        if( propertyValue.isValid() && propertyValue.toBool() ) return true;
+        _exceptionAppName = qApp->applicationName();
 
-        // list-based blacklisted widgets
-        const auto appName( qApp->applicationName() );
+        // white list
+        _whiteListClassNames.clear();
+        foreach( const ExceptionId& id, _whiteList )
+        {
+            if( !(id.appName().isEmpty() || id.appName() == _exceptionAppName ) ) continue;
+            _whiteListClassNames.append( id.className().toLatin1() );
+        }
+
+        // black list
+        _blackListAll = false;
+        _blackListClassNames.clear();
         foreach( const ExceptionId& id, _blackList )
         {
-            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
-            if( id.className() == QStringLiteral( "*" ) && !id.appName().isEmpty() )
-            {
-                // if application name matches and all classes are selected
-                // disable the grabbing entirely
-                setEnabled( false );
-                return true;
-            }
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            if( !id.appName().isEmpty() && id.appName() != _exceptionAppName ) continue;
+            if( id.className() == QStringLiteral( "*" ) && !id.appName().isEmpty() ) _blackListAll = true;
+            else _blackListClassNames.append( id.className().toLatin1() );
         }
 
+    }
+
+    //_____________________________________________________________
+    bool WindowManager::inheritsOneOf( const QWidget* widget, const QList<QByteArray>& classNames )
+    {
+        foreach( const QByteArray& className, classNames )
+        { if( widget->inherits( className.constData() ) ) return true; }
+
         return false;
     }
 
     //_____________________________________________________________
-    bool WindowManager::isWhiteListed( QWidget* widget ) const
+    bool WindowManager::isBlackListed( QWidget* widget )
     {
 
-        const auto appName( qApp->applicationName() );
-        foreach( const ExceptionId& id, _whiteList )
+        // check against noAnimations propery
+        const auto propertyValue( widget->property( PropertyNames::noWindowGrab ) );
+        if( propertyValue.isValid() && propertyValue.toBool() ) return true;
+
+        // resolve exceptions again if application name has changed since initialization
+        if( qApp->applicationName() != _exceptionAppName ) resolveExceptions();
+
+        if( _blackListAll )
         {
-            if( !(id.appName().isEmpty() || id.appName() == appName ) ) continue;
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            // if application name matches and all classes are selected
+            // disable the grabbing entirely
+            setEnabled( false );
+            return true;
         }
 
-        return false;
+        // list-based blacklisted widgets
+        return inheritsOneOf( widget, _blackListClassNames );
+    }
+
+    //_____________________________________________________________
+    bool WindowManager::isWhiteListed( QWidget* widget )
+    {
+
+        // resolve exceptions again if application name has changed since initialization
+        if( qApp->applicationName() != _exceptionAppName ) resolveExceptions();
+
+        // list-based whitelisted widgets
+        return inheritsOneOf( widget, _whiteListClassNames );
     }
 
     //_____________________________________________________________
@@ -841,6 +890,8 @@ namespace Breeze
         _quickTarget.clear();
         #endif
         if( _dragTimer.isActive() ) _dragTimer.stop();
+        if( _moveTimer.isActive() ) _moveTimer.stop();
+        _movePending = false;
         _dragPoint = QPoint();
         _globalDragPoint = QPoint();
         _dragAboutToStart = false;
@@ -848,6 +899,36 @@ namespace Breeze
 
     }
 
+    //____________________________________________________________
+    void WindowManager::applyPendingMove()
+    {
+
+        if( !_movePending ) return;
+        _movePending = false;
+
+        if( _target ) _target.data()->window()->move( _pendingPosition );
+
+    }
+
+    //____________________________________________________________
+    int WindowManager::moveInterval( QWidget* window ) const
+    {
+
+        #if QT_VERSION >= 0x050000
+        if( auto handle = window->windowHandle() )
+        {
+            if( handle->screen() && handle->screen()->refreshRate() > 0 )
+            { return qMax( 1, qRound( 1000/handle->screen()->refreshRate() ) ); }
+        }
+        #else
+        Q_UNUSED( window );
+        #endif
+
+        // default to 60Hz
+        return 16;
+
+    }
+
     //____________________________________________________________
     void WindowManager::startDrag( Window* window, const QPoint& position )
     {
@@ -28,6 +28,8 @@
 
 #include <QApplication>
 #include <QBasicTimer>
+#include <QByteArray>
+#include <QList>
 #include <QObject>
 #include <QSet>
 #include <QString>
@@ -143,6 +145,9 @@ namespace Breeze
         */
         void initializeBlackList();
 
+        //* resolve white and black listed class names for current application
+        void resolveExceptions();
+
         //* initializes the Wayland specific parts
         void initializeWayland();
 
@@ -158,7 +163,10 @@ namespace Breeze
         bool isBlackListed( QWidget* );
 
         //* returns true if widget is dragable
-        bool isWhiteListed( QWidget* ) const;
+        bool isWhiteListed( QWidget* );
+
+        //* returns true if widget inherits one of the classes in list
+        static bool inheritsOneOf( const QWidget*, const QList<QByteArray>& );
 
         //* returns true if drag can be started from current widget
         bool canDrag( QWidget* );
@@ -170,6 +178,12 @@ namespace Breeze
         //* reset drag
         void resetDrag();
 
+        //* move dragged window to pending position, if any
+        void applyPendingMove();
+
+        //* interval between two window moves (msec), matching screen refresh
+        int moveInterval( QWidget* ) const;
+
         #if QT_VERSION >= 0x050000
         using Window = QWindow;
         #else
@@ -275,6 +289,23 @@ namespace Breeze
         */
         ExceptionSet _blackList;
 
+        //*@name exceptions resolved for current application
+        //@{
+
+        //* application name for which exceptions are resolved
+        QString _exceptionAppName;
+
+        //* white listed class names
+        QList<QByteArray> _whiteListClassNames;
+
+        //* black listed class names
+        QList<QByteArray> _blackListClassNames;
+
+        //* true if all classes are black listed
+        bool _blackListAll = false;
+
+        //@}
+
         //* drag point
         QPoint _dragPoint;
         QPoint _globalDragPoint;
@@ -282,6 +313,24 @@ namespace Breeze
         //* drag timer
         QBasicTimer _dragTimer;
 
+        //*@name window moves, when not using WM move resize
+        /**
+        mouse moves can come much faster than the screen refreshes.
+        Window position is updated at most once per frame, to the last requested position
+        */
+        //@{
+
+        //* move timer
+        QBasicTimer _moveTimer;
+
+        //* pending window position
+        QPoint _pendingPosition;
+
+        //* true if a window move is pending
+        bool _movePending = false;
+
+        //@}
+
         //* target being dragged
         /** Weak pointer is used in case the target gets deleted while drag is in progress */
         WeakPointer<QWidget> _target;